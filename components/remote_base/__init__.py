@@ -36,8 +36,11 @@ from esphome.const import (
     CONF_ID,
     CONF_BUTTON,
     CONF_CHECK,
+    CONF_MIN,
+    CONF_MAX,
+    CONF_BUFFER_SIZE,
 )
-from esphome.core import coroutine
+from esphome.core import CORE, coroutine, coroutine_with_priority
 from esphome.schema_extractors import SCHEMA_EXTRACT, schema_extractor
 from esphome.util import Registry, SimpleRegistry
 
@@ -46,6 +49,14 @@ AUTO_LOAD = ["binary_sensor"]
 CONF_RECEIVER_ID = "receiver_id"
 CONF_TRANSMITTER_ID = "transmitter_id"
 CONF_FIRST = "first"
+CONF_PRUNE_PROTOCOLS = "prune_protocols"
+CONF_RECEIVERS = "receivers"
+CONF_REPEAT_CACHE_TIMEOUT = "repeat_cache_timeout"
+CONF_GLITCH_FILTER = "glitch_filter"
+CONF_ADAPTIVE_TOLERANCE = "adaptive_tolerance"
+CONF_ALLOC_TRACKING = "alloc_tracking"
+CONF_INLINE_TIMINGS = "inline_timings"
+CONF_ERROR_CORRECTION = "error_correction"
 
 ns = remote_base_ns = cg.esphome_ns.namespace("remote_base")
 RemoteProtocol = ns.class_("RemoteProtocol")
@@ -62,6 +73,7 @@ RemoteTransmitterActionBase = ns.class_(
     "RemoteTransmitterActionBase", RemoteTransmittable, automation.Action
 )
 RemoteReceiverBase = ns.class_("RemoteReceiverBase")
+ToleranceMode = ns.enum("ToleranceMode")
 RemoteTransmitterBase = ns.class_("RemoteTransmitterBase")
 
 
@@ -88,6 +100,194 @@ REMOTE_TRANSMITTABLE_SCHEMA = cv.Schema(
 )
 
 
+# Extra sources a protocol is built on
+PROTOCOL_DEPENDENCIES = {
+    "aeha": ["pulse_distance"],
+    "coolix": ["pulse_distance"],
+    "drayton": ["bi_phase"],
+    "jvc": ["pulse_distance"],
+    "lg": ["pulse_distance"],
+    "midea": ["pulse_distance"],
+    "nec": ["pulse_distance"],
+    "nexa": ["bi_phase"],
+    "panasonic": ["pulse_distance"],
+    "rc5": ["bi_phase"],
+    "rc6": ["bi_phase"],
+    "samsung": ["pulse_distance"],
+    "york": ["pulse_distance"],
+}
+
+
+# Longest frame each protocol sends, in timings, repeats included. Sizes the receive and transmit buffers when
+# they are inline, protocols not listed fit in DEFAULT_MAX_TIMINGS.
+PROTOCOL_MAX_TIMINGS = {
+    "abbwelcome": 490,
+    "aeha": 600,
+    "coolix": 200,
+    "haier": 229,
+    "midea": 200,
+    "mirage": 243,
+    "nexa": 132,
+    "pronto": 512,
+    "rc_switch": 132,
+    "samsung": 132,
+    "toshiba_ac": 300,
+    "york": 133,
+}
+# Also leaves room for the raw and hash dumpers and triggers to see frames of unknown protocols
+DEFAULT_MAX_TIMINGS = 256
+# Upper limit of the inline capacity, 16 kB per buffer
+MAX_INLINE_TIMINGS = 4096
+DATA_INLINE_TIMINGS = "remote_base_inline_timings"
+DATA_PROTOCOLS = "remote_base_protocols"
+
+
+def protocol_define(name):
+    # rc_switch_raw, rc_switch_type_a, ... all live in rc_switch_protocol.cpp
+    if name.startswith("rc_switch"):
+        name = "rc_switch"
+    return f"USE_REMOTE_BASE_{name.upper()}"
+
+
+def request_protocol(name):
+    """Compile in the sources of a protocol.
+
+    With prune_protocols set, protocol sources are only built for protocols a configuration actually uses.
+    Triggers, binary sensors, dumpers and actions request theirs automatically, components that use a protocol
+    class directly have to call this from their to_code().
+    """
+    cg.add_define(protocol_define(name))
+    for dependency in PROTOCOL_DEPENDENCIES.get(name, []):
+        cg.add_define(protocol_define(dependency))
+    if name.startswith("rc_switch"):
+        name = "rc_switch"
+    CORE.data.setdefault(DATA_PROTOCOLS, set()).add(name)
+
+
+def receiver_buffer_timings():
+    """Most timings one frame of a hardware remote_receiver can hold, going by its buffer_size.
+
+    The ESP32 RMT packs two timings into each 4 byte item, the other platforms keep a 4 byte timestamp per edge.
+    """
+    confs = CORE.config.get("remote_receiver", [])
+    if isinstance(confs, dict):
+        confs = [confs]
+    timings = 0
+    for conf in confs:
+        if (buffer_size := conf.get(CONF_BUFFER_SIZE)) is not None:
+            timings = max(timings, buffer_size // (2 if CORE.is_esp32 else 4))
+    return min(timings, MAX_INLINE_TIMINGS)
+
+
+def require_timings_capacity(timings):
+    """Switch RawTimings to inline storage holding at least the given number of timings.
+
+    The final capacity also covers the longest frame of every requested protocol, it is settled once all
+    components have generated their code.
+    """
+    if DATA_INLINE_TIMINGS not in CORE.data:
+        CORE.data[DATA_INLINE_TIMINGS] = timings
+        CORE.add_job(_define_timings_capacity)
+    CORE.data[DATA_INLINE_TIMINGS] = max(CORE.data[DATA_INLINE_TIMINGS], timings)
+
+
+@coroutine_with_priority(-1000.0)
+async def _define_timings_capacity():
+    capacity = max(
+        [CORE.data[DATA_INLINE_TIMINGS], DEFAULT_MAX_TIMINGS]
+        + [
+            PROTOCOL_MAX_TIMINGS.get(name, DEFAULT_MAX_TIMINGS)
+            for name in CORE.data.get(DATA_PROTOCOLS, ())
+        ]
+    )
+    cg.add_define("USE_REMOTE_BASE_INLINE_TIMINGS")
+    cg.add_define("REMOTE_BASE_TIMINGS_CAPACITY", capacity)
+
+
+def validate_adaptive_tolerance(value):
+    value = cv.Schema(
+        {
+            # In the receiver's tolerance unit, percent or microseconds
+            cv.Required(CONF_MIN): cv.uint32_t,
+            cv.Required(CONF_MAX): cv.uint32_t,
+        }
+    )(value)
+    if value[CONF_MIN] > value[CONF_MAX]:
+        raise cv.Invalid(f"{CONF_MIN} must not be larger than {CONF_MAX}")
+    if value[CONF_MAX] == 0:
+        raise cv.Invalid(f"{CONF_MAX} must be larger than 0")
+    return value
+
+
+# Receive pipeline options of one receiver, set for remote_receiver in the receivers list of the remote_base block
+# and directly on receiver platforms that extend their schema with it
+REMOTE_RECEIVER_OPTIONS_SCHEMA = cv.Schema(
+    {
+        cv.Optional(
+            CONF_REPEAT_CACHE_TIMEOUT, default="0ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_GLITCH_FILTER, default="0us"
+        ): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_ADAPTIVE_TOLERANCE): validate_adaptive_tolerance,
+        # Repair bits of Midea, Coolix and Toshiba AC frames from the copy each of them sends
+        cv.Optional(CONF_ERROR_CORRECTION, default=False): cv.boolean,
+    }
+)
+
+
+async def setup_receiver_options(var, config):
+    if config[CONF_REPEAT_CACHE_TIMEOUT].total_milliseconds > 0:
+        cg.add(var.set_repeat_cache_timeout(config[CONF_REPEAT_CACHE_TIMEOUT]))
+    if config[CONF_GLITCH_FILTER].total_microseconds > 0:
+        cg.add(var.set_glitch_filter(config[CONF_GLITCH_FILTER]))
+    if adaptive := config.get(CONF_ADAPTIVE_TOLERANCE):
+        cg.add(var.set_adaptive_tolerance(adaptive[CONF_MIN], adaptive[CONF_MAX]))
+    if config[CONF_ERROR_CORRECTION]:
+        cg.add(var.set_error_correction(True))
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        # Only build the protocols requested by triggers, binary sensors, dumpers, actions and request_protocol().
+        # Off by default, climate_ir platforms and lambdas use protocol classes without requesting them.
+        cv.Optional(CONF_PRUNE_PROTOCOLS, default=False): cv.boolean,
+        # Count heap allocations per listener, dumper and action, logged and published by the remote_base sensor
+        cv.Optional(CONF_ALLOC_TRACKING, default=False): cv.boolean,
+        # Keep frames in fixed buffers instead of std::vector, sized for the protocols in use and the buffer_size
+        # of the remote_receivers, a number is the least number of timings they hold
+        cv.Optional(CONF_INLINE_TIMINGS, default=False): cv.Any(
+            cv.boolean, cv.int_range(min=1, max=MAX_INLINE_TIMINGS)
+        ),
+        cv.Optional(CONF_RECEIVERS, default=[]): cv.ensure_list(
+            REMOTE_RECEIVER_OPTIONS_SCHEMA.extend(
+                {
+                    cv.GenerateID(CONF_RECEIVER_ID): cv.use_id(RemoteReceiverBase),
+                }
+            )
+        ),
+    }
+)
+
+
+async def to_code(config):
+    if not config[CONF_PRUNE_PROTOCOLS]:
+        for name in sorted(
+            set(DUMPER_REGISTRY.keys()) | set(BINARY_SENSOR_REGISTRY.keys())
+        ):
+            request_protocol(name)
+    if config[CONF_ALLOC_TRACKING]:
+        cg.add_define("USE_REMOTE_BASE_ALLOC_TRACKING")
+    if (inline_timings := config[CONF_INLINE_TIMINGS]) is not False:
+        # Whatever the receivers can capture has to fit, or raw and hash listeners would see a cut off frame
+        require_timings_capacity(receiver_buffer_timings())
+        if inline_timings is not True:
+            require_timings_capacity(inline_timings)
+    for conf in config[CONF_RECEIVERS]:
+        receiver = await cg.get_variable(conf[CONF_RECEIVER_ID])
+        await setup_receiver_options(receiver, conf)
+
+
 async def register_listener(var, config):
     receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
     cg.add(receiver.register_listener(var))
@@ -115,6 +315,7 @@ def register_trigger(name, type, data_type):
 
     def decorator(func):
         async def new_func(config):
+            request_protocol(name)
             var = cg.new_Pvariable(config[CONF_TRIGGER_ID])
             await coroutine(func)(var, config)
             await automation.build_automation(var, [(data_type, "x")], config)
@@ -130,6 +331,7 @@ def register_dumper(name, type):
 
     def decorator(func):
         async def new_func(config, dumper_id):
+            request_protocol(name)
             var = cg.new_Pvariable(dumper_id)
             await coroutine(func)(var, config)
             return var
@@ -167,6 +369,7 @@ def register_action(name, type_, schema):
 
     def decorator(func):
         async def new_func(config, action_id, template_arg, args):
+            request_protocol(name)
             var = cg.new_Pvariable(action_id, template_arg)
             await register_transmittable(var, config)
             if CONF_REPEAT in config:
@@ -241,6 +444,7 @@ async def build_binary_sensor(full_config):
     )
     type_id = full_config[CONF_TYPE_ID]
     builder = registry_entry.coroutine_fun
+    request_protocol(registry_entry.name)
     var = cg.new_Pvariable(type_id)
     await cg.register_component(var, full_config)
     await register_listener(var, full_config)
@@ -1035,6 +1239,27 @@ async def raw_action(var, config, args):
     cg.add(var.set_carrier_frequency(templ))
 
 
+# Hash
+HashData, HashBinarySensor, HashTrigger, HashAction, HashDumper = declare_protocol("Hash")
+CONF_HASH = "hash"
+HASH_SCHEMA = cv.Schema({cv.Required(CONF_HASH): cv.hex_uint32_t})
+
+
+@register_binary_sensor("hash", HashBinarySensor, HASH_SCHEMA)
+def hash_binary_sensor(var, config):
+    cg.add(var.set_data(cg.StructInitializer(HashData, ("hash", config[CONF_HASH]))))
+
+
+@register_trigger("hash", HashTrigger, HashData)
+def hash_trigger(var, config):
+    pass
+
+
+@register_dumper("hash", HashDumper)
+def hash_dumper(var, config):
+    pass
+
+
 # Drayton
 (
     DraytonData,
@@ -1805,7 +2030,7 @@ HAIER_SCHEMA = cv.Schema(
 
 @register_binary_sensor("haier", HaierBinarySensor, HAIER_SCHEMA)
 def haier_binary_sensor(var, config):
-    cg.add(var.set_code(config[CONF_CODE]))
+    cg.add(var.set_data(cg.StructInitializer(HaierData, ("data", config[CONF_CODE]))))
 
 
 @register_trigger("haier", HaierTrigger, HaierData)
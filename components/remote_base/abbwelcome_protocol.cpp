@@ -1,6 +1,8 @@
 #include "abbwelcome_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_ABBWELCOME
+
 namespace esphome {
 namespace remote_base {
 
@@ -107,7 +109,7 @@ optional<ABBWelcomeData> ABBWelcomeProtocol::decode(RemoteReceiveData src) {
       out[received_bytes] = data;
     }
     if (out.is_valid()) {
-      ESP_LOGI(TAG, "Received: %s", out.to_string().c_str());
+      ESP_LOGV(TAG, "Received: %s", out.to_string().c_str());
       return out;
     }
     ESP_LOGW(TAG, "Received malformed packet: %s", out.to_string(received_bytes).c_str());
@@ -121,3 +123,5 @@ void ABBWelcomeProtocol::dump(const ABBWelcomeData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_ABBWELCOME
@@ -119,7 +119,7 @@ class ABBWelcomeData {
   }
   void set_message_id(uint8_t message_id) { this->data_[4 + 2 * this->get_address_length()] = message_id; }
   uint8_t get_message_id() const { return this->data_[4 + 2 * this->get_address_length()]; }
-  void set_data(std::vector<uint8_t> data) {
+  void set_data(const std::vector<uint8_t> &data) {
     uint8_t size = std::min(MAX_DATA_LENGTH, static_cast<uint8_t>(data.size()));
     this->data_[2] &= (0xff ^ DATA_LENGTH_MASK);
     this->data_[2] |= (size & DATA_LENGTH_MASK);
@@ -165,22 +165,27 @@ class ABBWelcomeData {
     return (this->auto_message_id || rhs.auto_message_id) && this->is_valid() && rhs.is_valid() &&
            (this->get_message_type() == rhs.get_message_type()) &&
            (this->get_source_address() == rhs.get_source_address()) &&
-           (this->get_destination_address() == rhs.get_destination_address()) && (this->get_data() == rhs.get_data());
+           (this->get_destination_address() == rhs.get_destination_address()) &&
+           (this->get_data_size() == rhs.get_data_size()) &&
+           std::equal(this->payload_(), this->payload_() + this->get_data_size(), rhs.payload_());
   }
   uint8_t &operator[](size_t idx) { return this->data_[idx]; }
   const uint8_t &operator[](size_t idx) const { return this->data_[idx]; }
 
  protected:
+  // Start of the data bytes, compared in place so matching does not copy them out like get_data()
+  const uint8_t *payload_() const { return this->data_.data() + 5 + 2 * this->get_address_length(); }
+
   std::array<uint8_t, 12 + MAX_DATA_LENGTH> data_;
   // Calculate checksum
   uint8_t calc_cs_() const;
 };
 
-class ABBWelcomeProtocol : public RemoteProtocol<ABBWelcomeData> {
+class ABBWelcomeProtocol : public StaticRemoteProtocol<ABBWelcomeData> {
  public:
-  void encode(RemoteTransmitData *dst, const ABBWelcomeData &src) override;
-  optional<ABBWelcomeData> decode(RemoteReceiveData src) override;
-  void dump(const ABBWelcomeData &data) override;
+  void encode(RemoteTransmitData *dst, const ABBWelcomeData &src);
+  optional<ABBWelcomeData> decode(RemoteReceiveData src);
+  void dump(const ABBWelcomeData &data);
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t data) const;
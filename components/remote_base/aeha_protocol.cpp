@@ -1,7 +1,10 @@
 #include "aeha_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_AEHA
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,28 +18,23 @@ static const uint16_t BIT_ONE_LOW_US = BITWISE * 3;
 static const uint16_t BIT_ZERO_LOW_US = BITWISE;
 static const uint16_t TRAILER = BITWISE;
 
-void AEHAProtocol::encode(RemoteTransmitData *dst, const AEHAData &data) {
-  dst->reserve(2 + 32 + (data.data.size() * 2) + 1);
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_MSB_FIRST});
 
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
+bool AEHAProtocol::check_data_length(size_t length) {
+  if (length <= AEHA_MAX_DATA_LENGTH)
+    return true;
+  ESP_LOGE(TAG, "Data of %u bytes is longer than the %u an AEHA frame holds, not sending", (unsigned) length,
+           (unsigned) AEHA_MAX_DATA_LENGTH);
+  return false;
+}
 
-  for (uint16_t mask = 1 << 15; mask != 0; mask >>= 1) {
-    if (data.address & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+void AEHAProtocol::encode(RemoteTransmitData *dst, const AEHAData &data) {
+  dst->reserve(2 + 32 + (data.data.size() * 2) + 1);
 
-  for (uint8_t bit : data.data) {
-    for (uint8_t mask = 1 << 7; mask != 0; mask >>= 1) {
-      if (bit & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_bits(dst, data.address, 16);
+  CODEC.encode_bytes(dst, data.data.data(), data.data.size());
 
   dst->mark(TRAILER);
 }
@@ -45,31 +43,15 @@ optional<AEHAData> AEHAProtocol::decode(RemoteReceiveData src) {
       .address = 0,
       .data = {},
   };
-  if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
+  if (!CODEC.decode_header(src) || !CODEC.decode_bits(src, out.address, 16))
     return {};
 
-  for (uint16_t mask = 1 << 15; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.address |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.address &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint8_t pos = 0; pos < 35; pos++) {
-    uint8_t data = 0;
-    for (uint8_t mask = 1 << 7; mask != 0; mask >>= 1) {
-      if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-        data |= mask;
-      } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-        data &= ~mask;
-      } else if (pos > 1 && src.expect_mark(TRAILER)) {
+  for (uint8_t pos = 0; pos < AEHA_MAX_DATA_LENGTH; pos++) {
+    uint64_t data;
+    if (CODEC.decode_bits_up_to(src, data, 8) != 8) {
+      if (pos > 1 && src.expect_mark(TRAILER))
         return out;
-      } else {
-        return {};
-      }
+      return {};
     }
 
     out.data.push_back(data);
@@ -82,11 +64,11 @@ optional<AEHAData> AEHAProtocol::decode(RemoteReceiveData src) {
   return {};
 }
 
-std::string AEHAProtocol::format_data_(const std::vector<uint8_t> &data) {
+std::string AEHAProtocol::format_data_(const uint8_t *data, size_t size) {
   std::string out;
-  for (uint8_t byte : data) {
+  for (size_t i = 0; i < size; i++) {
     char buf[6];
-    sprintf(buf, "0x%02X,", byte);
+    sprintf(buf, "0x%02X,", data[i]);
     out += buf;
   }
   out.pop_back();
@@ -94,9 +76,11 @@ std::string AEHAProtocol::format_data_(const std::vector<uint8_t> &data) {
 }
 
 void AEHAProtocol::dump(const AEHAData &data) {
-  auto data_str = format_data_(data.data);
+  auto data_str = format_data_(data.data.data(), data.data.size());
   ESP_LOGI(TAG, "Received AEHA: address=0x%04X, data=[%s]", data.address, data_str.c_str());
 }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_AEHA
@@ -7,21 +7,26 @@
 namespace esphome {
 namespace remote_base {
 
+/// Longest payload an AEHA frame carries, in bytes.
+static const uint8_t AEHA_MAX_DATA_LENGTH = 35;
+
 struct AEHAData {
   uint16_t address;
-  std::vector<uint8_t> data;
+  InlineBuffer<uint8_t, AEHA_MAX_DATA_LENGTH> data;
 
   bool operator==(const AEHAData &rhs) const { return address == rhs.address && data == rhs.data; }
 };
 
-class AEHAProtocol : public RemoteProtocol<AEHAData> {
+class AEHAProtocol : public StaticRemoteProtocol<AEHAData> {
  public:
-  void encode(RemoteTransmitData *dst, const AEHAData &data) override;
-  optional<AEHAData> decode(RemoteReceiveData src) override;
-  void dump(const AEHAData &data) override;
+  void encode(RemoteTransmitData *dst, const AEHAData &data);
+  optional<AEHAData> decode(RemoteReceiveData src);
+  void dump(const AEHAData &data);
+  /// Logs and returns false if data of length bytes does not fit into AEHAData.
+  static bool check_data_length(size_t length);
 
  private:
-  std::string format_data_(const std::vector<uint8_t> &data);
+  std::string format_data_(const uint8_t *data, size_t size);
 };
 
 DECLARE_REMOTE_PROTOCOL(AEHA)
@@ -34,9 +39,12 @@ template<typename... Ts> class AEHAAction : public RemoteTransmitterActionBase<T
 
   void set_data(const std::vector<uint8_t> &data) { data_ = data; }
   void encode(RemoteTransmitData *dst, Ts... x) override {
+    const auto payload = this->data_.value(x...);
+    if (!AEHAProtocol::check_data_length(payload.size()))
+      return;
     AEHAData data{};
     data.address = this->address_.value(x...);
-    data.data = this->data_.value(x...);
+    data.data = payload;
     dst->set_carrier_frequency(this->carrier_frequency_.value(x...));
     AEHAProtocol().encode(dst, data);
   }
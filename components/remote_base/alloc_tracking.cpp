@@ -0,0 +1,146 @@
+#include "alloc_tracking.h"
+
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <new>
+
+namespace esphome {
+namespace remote_base {
+
+static const char *const TAG = "remote_base.alloc";
+
+uint32_t AllocTracker::allocations_ = 0;
+uint32_t AllocTracker::bytes_ = 0;
+AllocStats AllocTracker::owners_[AllocTracker::MAX_OWNERS] = {};
+AllocStats AllocTracker::overflow_ = {};
+AllocStats *AllocTracker::current_ = nullptr;
+AllocStats AllocTracker::cycles_[2] = {};
+AllocStats *AllocTracker::cycle_ = nullptr;
+uint32_t AllocTracker::last_log_ = 0;
+
+void AllocTracker::record(size_t size) {
+  allocations_++;
+  bytes_ += size;
+  if (current_ != nullptr) {
+    current_->allocations++;
+    current_->bytes += size;
+  }
+  if (cycle_ != nullptr) {
+    cycle_->allocations++;
+    cycle_->bytes += size;
+  }
+}
+
+void AllocTracker::reset() {
+  allocations_ = 0;
+  bytes_ = 0;
+  for (auto &stats : owners_) {
+    stats.calls = 0;
+    stats.allocations = 0;
+    stats.bytes = 0;
+  }
+  overflow_ = {};
+  cycles_[0] = {};
+  cycles_[1] = {};
+}
+
+AllocStats *AllocTracker::find_(AllocOwnerKind kind, const void *owner, uint16_t index) {
+  for (auto &stats : owners_) {
+    if (stats.owner == owner && stats.kind == kind && stats.index == index)
+      return &stats;
+    if (stats.owner == nullptr) {
+      stats = {owner, kind, index, 0, 0, 0};
+      return &stats;
+    }
+  }
+  return &overflow_;
+}
+
+static const char *owner_kind_to_string(AllocOwnerKind kind) {
+  switch (kind) {
+    case ALLOC_OWNER_RECEIVER:
+      return "receiver";
+    case ALLOC_OWNER_LISTENER:
+      return "listener";
+    case ALLOC_OWNER_DUMPER:
+      return "dumper";
+    case ALLOC_OWNER_ACTION:
+      return "action";
+    case ALLOC_OWNER_TRANSMITTER:
+      return "transmitter";
+    default:
+      return "unknown";
+  }
+}
+
+void AllocTracker::log_stats() {
+  ESP_LOGD(TAG, "Heap allocations: %" PRIu32 " (%" PRIu32 " bytes)", allocations_, bytes_);
+  static const char *const CYCLE_NAMES[] = {"receive", "transmit"};
+  for (uint8_t idx = 0; idx < 2; idx++) {
+    const AllocStats &cycle = cycles_[idx];
+    if (cycle.calls == 0)
+      continue;
+    ESP_LOGD(TAG, "  Per %s cycle: %.2f allocations, %.1f bytes over %" PRIu32 " cycles", CYCLE_NAMES[idx],
+             float(cycle.allocations) / cycle.calls, float(cycle.bytes) / cycle.calls, cycle.calls);
+  }
+  for (const auto &stats : owners_) {
+    if (stats.owner == nullptr)
+      break;
+    if (stats.allocations == 0)
+      continue;
+    ESP_LOGD(TAG, "  %s #%u (%p): %" PRIu32 " allocations, %" PRIu32 " bytes in %" PRIu32 " calls",
+             owner_kind_to_string(stats.kind), stats.index, stats.owner, stats.allocations, stats.bytes, stats.calls);
+  }
+  if (overflow_.allocations > 0)
+    ESP_LOGD(TAG, "  other: %" PRIu32 " allocations, %" PRIu32 " bytes", overflow_.allocations, overflow_.bytes);
+}
+
+AllocScope::AllocScope(AllocOwnerKind kind, const void *owner, uint16_t index)
+    : prev_(AllocTracker::current_), root_(AllocTracker::cycle_ == nullptr) {
+  AllocTracker::current_ = AllocTracker::find_(kind, owner, index);
+  AllocTracker::current_->calls++;
+  if (this->root_) {
+    AllocTracker::cycle_ = &AllocTracker::cycles_[kind == ALLOC_OWNER_RECEIVER ? 0 : 1];
+    AllocTracker::cycle_->calls++;
+  }
+}
+
+AllocScope::~AllocScope() {
+  AllocTracker::current_ = this->prev_;
+  if (!this->root_)
+    return;
+  AllocTracker::cycle_ = nullptr;
+  const uint32_t now = millis();
+  if (AllocTracker::last_log_ == 0 || now - AllocTracker::last_log_ >= AllocTracker::LOG_INTERVAL) {
+    AllocTracker::last_log_ = now | 1;
+    AllocTracker::log_stats();
+  }
+}
+
+}  // namespace remote_base
+}  // namespace esphome
+
+// Replacing the global allocation functions is the only portable hook, it covers every container and string
+void *operator new(size_t size) {
+  esphome::remote_base::AllocTracker::record(size);
+  void *ptr = std::malloc(size != 0 ? size : 1);
+  if (ptr == nullptr) {
+#if __cpp_exceptions
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return ptr;
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  esphome::remote_base::AllocTracker::record(size);
+  return std::malloc(size != 0 ? size : 1);
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+#endif  // USE_REMOTE_BASE_ALLOC_TRACKING
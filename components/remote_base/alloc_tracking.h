@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/defines.h"
+
+namespace esphome {
+namespace remote_base {
+
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+
+enum AllocOwnerKind : uint8_t {
+  ALLOC_OWNER_RECEIVER,
+  ALLOC_OWNER_LISTENER,
+  ALLOC_OWNER_DUMPER,
+  /// Transmit actions and other RemoteTransmittables
+  ALLOC_OWNER_ACTION,
+  ALLOC_OWNER_TRANSMITTER,
+};
+
+struct AllocStats {
+  const void *owner;
+  AllocOwnerKind kind;
+  uint16_t index;
+  uint32_t calls;
+  uint32_t allocations;
+  uint32_t bytes;
+};
+
+/// Counts heap allocations made through operator new and attributes them to the innermost AllocScope. A scope
+/// opened outside any other one starts a receive or transmit cycle, the cycle totals include nested scopes.
+/// Allocations made by other tasks while a scope is open count towards it as well. The stats are logged at the end
+/// of the first cycle and then of the first cycle every LOG_INTERVAL ms, for whichever receiver or transmitter.
+class AllocTracker {
+ public:
+  static void record(size_t size);
+  static uint32_t get_allocations() { return allocations_; }
+  static uint32_t get_bytes() { return bytes_; }
+  /// Inclusive totals of all receive (transmit) cycles since the last reset(), calls counts the cycles.
+  static const AllocStats &get_cycle_stats(bool transmit) { return cycles_[transmit ? 1 : 0]; }
+  static void reset();
+  static void log_stats();
+
+ protected:
+  friend class AllocScope;
+  static const size_t MAX_OWNERS = 32;
+  static const uint32_t LOG_INTERVAL = 60000;
+
+  static AllocStats *find_(AllocOwnerKind kind, const void *owner, uint16_t index);
+
+  static uint32_t allocations_;
+  static uint32_t bytes_;
+  static AllocStats owners_[MAX_OWNERS];
+  /// Allocations of owners that did not fit the table
+  static AllocStats overflow_;
+  static AllocStats *current_;
+  /// Inclusive totals per cycle, index 0 receive, 1 transmit
+  static AllocStats cycles_[2];
+  static AllocStats *cycle_;
+  /// millis() of the last log_stats() from a cycle end, 0 before the first
+  static uint32_t last_log_;
+};
+
+/// Attributes allocations to owner while alive, scopes nest.
+class AllocScope {
+ public:
+  AllocScope(AllocOwnerKind kind, const void *owner, uint16_t index = 0);
+  ~AllocScope();
+
+ protected:
+  AllocStats *prev_;
+  bool root_;
+};
+
+#define REMOTE_BASE_ALLOC_SCOPE(kind, owner, index) AllocScope alloc_scope_(kind, owner, index)
+#else
+#define REMOTE_BASE_ALLOC_SCOPE(kind, owner, index)
+#endif  // USE_REMOTE_BASE_ALLOC_TRACKING
+
+}  // namespace remote_base
+}  // namespace esphome
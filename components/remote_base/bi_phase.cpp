@@ -0,0 +1,140 @@
+#include "bi_phase.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef USE_REMOTE_BASE_BI_PHASE
+
+namespace esphome {
+namespace remote_base {
+
+static const uint8_t INVALID_PAIRS = 0xFF;
+
+// Four levels (two pairs, first level in bit 3) to two bits: '10' is a 1, '01' a 0, anything else is no bit
+static const uint8_t PAIR_BITS[16] = {
+    INVALID_PAIRS, INVALID_PAIRS, INVALID_PAIRS, INVALID_PAIRS,  // 00xx
+    INVALID_PAIRS, 0b00,          0b01,          INVALID_PAIRS,  // 01xx
+    INVALID_PAIRS, 0b10,          0b11,          INVALID_PAIRS,  // 10xx
+    INVALID_PAIRS, INVALID_PAIRS, INVALID_PAIRS, INVALID_PAIRS,  // 11xx
+};
+
+void BiPhaseLevels::clear() {
+  memset(this->data_, 0, sizeof(this->data_));
+  this->size_ = 0;
+}
+
+uint8_t BiPhaseLevels::get_nibble_(uint16_t index) const {
+  // The spare byte at the end keeps the second read inside data_
+  const uint16_t word = (this->data_[index / 8] << 8) | this->data_[index / 8 + 1];
+  return (word >> (12 - index % 8)) & 0x0F;
+}
+
+bool BiPhaseLevels::decode_bits(uint16_t index, uint8_t nbits, uint32_t &value) const {
+  if (nbits > 32 || index + 2 * nbits > this->size_)
+    return false;
+  uint32_t out = 0;
+  uint8_t bit = 0;
+  for (; bit + 2 <= nbits; bit += 2, index += 4) {
+    const uint8_t pairs = PAIR_BITS[this->get_nibble_(index)];
+    if (pairs == INVALID_PAIRS)
+      return false;
+    out = (out << 2) | pairs;
+  }
+  if (bit < nbits) {
+    // Odd bit count, complete the last pair with a valid one and drop its bit
+    const uint8_t pairs = PAIR_BITS[(this->get_nibble_(index) & 0x0C) | 0b10];
+    if (pairs == INVALID_PAIRS)
+      return false;
+    out = (out << 1) | (pairs >> 1);
+  }
+  value = out;
+  return true;
+}
+
+BiPhaseWindows BiPhaseCodec::windows(const RemoteReceiveData &src) const {
+  BiPhaseWindows windows{};
+  windows.max_units = std::min(this->max_units_, BiPhaseWindows::MAX_UNITS);
+  for (uint8_t units = 1; units <= windows.max_units; units++) {
+    windows.lo[units - 1] = src.lower_bound(units * this->unit_);
+    windows.hi[units - 1] = src.upper_bound(units * this->unit_);
+  }
+  return windows;
+}
+
+uint16_t BiPhaseCodec::expand(RemoteReceiveData &src, const BiPhaseWindows &windows, BiPhaseLevels &levels) const {
+  const uint8_t max_units = windows.max_units;
+  const int32_t *lo = windows.lo;
+  const int32_t *hi = windows.hi;
+  const uint16_t start = levels.size();
+  // Locals only, stores into levels would otherwise force src to be reloaded for every item
+  const RawTimings &raw = src.get_raw_data();
+  const int32_t *data = raw.data() + src.get_index();
+  const uint32_t count = raw.size() - src.get_index();
+  const bool tracking = src.is_tracking_deviation();
+  bool gap = true;
+  uint32_t index = 0;
+  for (; index < count; index++) {
+    const int32_t value = data[index];
+    const int32_t length = std::abs(value);
+    // Longest first so the shortest matching multiple wins where windows overlap, without branching on the length
+    uint8_t units = 0;
+    for (uint8_t i = max_units; i > 0; i--)
+      units = lo[i - 1] <= length && length <= hi[i - 1] ? i : units;
+    if (units == 0) {
+      gap = value < 0 && length > hi[max_units - 1];
+      break;
+    }
+    if (!levels.push(value > 0, units)) {
+      gap = false;
+      break;
+    }
+    if (tracking)
+      src.note_deviation(value, units * this->unit_);
+  }
+  src.advance(index);
+  if (gap && levels.size() > start && levels.back())
+    levels.push(false);
+  return levels.size() - start;
+}
+
+static inline void write_level(RemoteTransmitData *dst, bool level, uint32_t length) {
+  if (level) {
+    dst->mark(length);
+  } else {
+    dst->space(length);
+  }
+}
+
+void BiPhaseWriter::push_bits(uint32_t value, uint8_t nbits) {
+  // Works on locals, the compiler cannot keep members in registers across writes to dst
+  RemoteTransmitData *dst = this->dst_;
+  const uint32_t unit = this->unit_;
+  bool level = this->level_;
+  uint32_t units = this->units_;
+  for (uint8_t bit = nbits; bit > 0; bit--) {
+    const bool one = (value >> (bit - 1)) & 1;
+    // The first half extends the pending level if it matches, the second half always differs from the first
+    if (one != level && units != 0) {
+      write_level(dst, level, units * unit);
+      units = 0;
+    }
+    write_level(dst, one, (units + 1) * unit);
+    level = !one;
+    units = 1;
+  }
+  this->level_ = level;
+  this->units_ = units;
+}
+
+void BiPhaseWriter::flush() {
+  if (this->units_ == 0)
+    return;
+  write_level(this->dst_, this->level_, this->units_ * this->unit_);
+  this->units_ = 0;
+}
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_BI_PHASE
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "remote_base.h"
+
+#include <cstddef>
+
+namespace esphome {
+namespace remote_base {
+
+/// Half-bit levels of a bi-phase (Manchester) frame, a mark is a 1 and a space a 0. Every bit of the frame is a pair
+/// of opposite levels, the level of the first half is the bit value.
+class BiPhaseLevels {
+ public:
+  static constexpr uint16_t CAPACITY = 192;
+
+  uint16_t size() const { return this->size_; }
+  bool get(uint16_t index) const { return (this->data_[index / 8] >> (7 - index % 8)) & 1; }
+  bool back() const { return this->get(this->size_ - 1); }
+  /// Append count (at most 8) copies of level, returns false and appends nothing if they do not fit.
+  bool push(bool level, uint8_t count = 1) {
+    if (count > 8 || this->size_ + count > CAPACITY)
+      return false;
+    // Levels past size_ are always spaces, only marks are written. Branch free, the levels of a frame are random.
+    const uint16_t run = level ? uint16_t(0xFFFF << (16 - count)) : 0;
+    const uint16_t marks = run >> (this->size_ % 8);
+    this->data_[this->size_ / 8] |= marks >> 8;
+    this->data_[this->size_ / 8 + 1] |= marks & 0xFF;
+    this->size_ += count;
+    return true;
+  }
+  void clear();
+  /// Decode nbits (at most 32) bits from the level pairs starting at index, the first bit is the most significant.
+  /// Fails if a pair is missing or does not change level in the middle.
+  bool decode_bits(uint16_t index, uint8_t nbits, uint32_t &value) const;
+
+ protected:
+  /// Four levels starting at index, the first one in bit 3.
+  uint8_t get_nibble_(uint16_t index) const;
+
+  // One spare byte, push() writes the byte after the last level
+  uint8_t data_[CAPACITY / 8 + 1]{};
+  uint16_t size_{0};
+};
+
+/// Accepted lengths of a mark or space of one to max_units units, see BiPhaseCodec::windows().
+struct BiPhaseWindows {
+  static constexpr uint8_t MAX_UNITS = 4;
+  uint8_t max_units;
+  int32_t lo[MAX_UNITS];
+  int32_t hi[MAX_UNITS];
+};
+
+/// Writes levels as marks and spaces, equal neighbouring levels are merged into one mark or space.
+class BiPhaseWriter {
+ public:
+  BiPhaseWriter(RemoteTransmitData *dst, uint32_t unit) : dst_(dst), unit_(unit) {}
+
+  void push(bool level, uint8_t count = 1) {
+    if (level != this->level_)
+      this->flush();
+    this->level_ = level;
+    this->units_ += count;
+  }
+  /// Append the lowest nbits of value, most significant bit first, each bit as the level pair (bit, !bit).
+  void push_bits(uint32_t value, uint8_t nbits);
+  /// Write the pending mark or space, call once the frame is complete.
+  void flush();
+
+ protected:
+  RemoteTransmitData *dst_;
+  uint32_t unit_;
+  bool level_{false};
+  uint8_t units_{0};
+};
+
+/// Shared decoder/encoder for bi-phase protocols (RC5, RC6, Drayton, Nexa). Timings are first converted into a
+/// BiPhaseLevels stream in one pass, each mark or space becoming one or more unit long levels, and bits are then
+/// decoded from that stream with a table lookup instead of peeking at every combination of half and full bit lengths.
+class BiPhaseCodec {
+ public:
+  /// unit is the length of one level, max_units the longest mark or space in the protocol in units (2 for plain
+  /// bi-phase, more for protocols with double length bits or sync symbols).
+  constexpr BiPhaseCodec(uint32_t unit, uint8_t max_units = 2) : unit_(unit), max_units_(max_units) {}
+
+  uint32_t get_unit() const { return this->unit_; }
+
+  /// Append the levels of the marks and spaces from the current index up to the first one that is not a multiple
+  /// of the unit, and advance past them. If the frame ends there on a mark, the level of the trailing gap is added
+  /// as well, so a frame whose last half-bit is a space is complete. Returns the number of levels appended.
+  uint16_t expand(RemoteReceiveData &src, BiPhaseLevels &levels) const {
+    return this->expand(src, this->windows(src), levels);
+  }
+  /// Same as above with windows worked out once, for decoders that call expand() at many positions of a frame.
+  uint16_t expand(RemoteReceiveData &src, const BiPhaseWindows &windows, BiPhaseLevels &levels) const;
+  /// Same acceptance as peek_mark()/peek_space() for every multiple of the unit.
+  BiPhaseWindows windows(const RemoteReceiveData &src) const;
+  BiPhaseWriter writer(RemoteTransmitData *dst) const { return BiPhaseWriter(dst, this->unit_); }
+
+ protected:
+  uint32_t unit_;
+  uint8_t max_units_;
+};
+
+}  // namespace remote_base
+}  // namespace esphome
@@ -3,6 +3,8 @@
 
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_BYRONSX
+
 namespace esphome {
 namespace remote_base {
 
@@ -137,3 +139,5 @@ void ByronSXProtocol::dump(const ByronSXData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_BYRONSX
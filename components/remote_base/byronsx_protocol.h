@@ -18,16 +18,18 @@ struct ByronSXData {
     }
     return (rhs.command == 0x10 || command == rhs.command);
   }
+  // The wildcard command is left out so it shares the key of every command
+  uint64_t index_key() const { return address; }
 };
 
-class ByronSXProtocol : public RemoteProtocol<ByronSXData> {
+class ByronSXProtocol : public StaticRemoteProtocol<ByronSXData> {
  public:
-  void encode(RemoteTransmitData *dst, const ByronSXData &data) override;
-  optional<ByronSXData> decode(RemoteReceiveData src) override;
-  void dump(const ByronSXData &data) override;
+  void encode(RemoteTransmitData *dst, const ByronSXData &data);
+  optional<ByronSXData> decode(RemoteReceiveData src);
+  void dump(const ByronSXData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(ByronSX)
+DECLARE_INDEXED_REMOTE_PROTOCOL(ByronSX)
 
 template<typename... Ts> class ByronSXAction : public RemoteTransmitterActionBase<Ts...> {
  public:
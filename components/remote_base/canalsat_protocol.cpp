@@ -1,6 +1,8 @@
 #include "canalsat_protocol.h"
 #include "esphome/core/log.h"
 
+#if defined(USE_REMOTE_BASE_CANALSAT) || defined(USE_REMOTE_BASE_CANALSATLD)
+
 namespace esphome {
 namespace remote_base {
 
@@ -106,3 +108,5 @@ void CanalSatBaseProtocol::dump(const CanalSatData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_CANALSAT || USE_REMOTE_BASE_CANALSATLD
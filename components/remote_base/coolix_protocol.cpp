@@ -1,6 +1,9 @@
 #include "coolix_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_COOLIX
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,6 +18,9 @@ static const int32_t BIT_ZERO_SPACE_US = 1 * TICK_US;
 static const int32_t FOOTER_MARK_US = 1 * TICK_US;
 static const int32_t FOOTER_SPACE_US = 10 * TICK_US;
 
+static constexpr PulseDistanceCodec CODEC({HEADER_MARK_US, HEADER_SPACE_US, BIT_MARK_US, BIT_ONE_SPACE_US,
+                                           BIT_ZERO_SPACE_US, BIT_ORDER_MSB_FIRST});
+
 bool CoolixData::operator==(const CoolixData &other) const {
   if (this->first == 0)
     return this->second == other.first || this->second == other.second;
@@ -25,18 +31,16 @@ bool CoolixData::operator==(const CoolixData &other) const {
 
 static void encode_frame(RemoteTransmitData *dst, const uint32_t &src) {
   // Append header
-  dst->item(HEADER_MARK_US, HEADER_SPACE_US);
+  CODEC.encode_header(dst);
   // Break data into bytes, starting at the Most Significant
   // Byte. Each byte then being sent normal, then followed inverted.
   for (unsigned shift = 16;; shift -= 8) {
     // Grab a bytes worth of data
     const uint8_t byte = src >> shift;
     // Normal
-    for (uint8_t mask = 1 << 7; mask; mask >>= 1)
-      dst->item(BIT_MARK_US, (byte & mask) ? BIT_ONE_SPACE_US : BIT_ZERO_SPACE_US);
+    CODEC.encode_bytes(dst, &byte, 1);
     // Inverted
-    for (uint8_t mask = 1 << 7; mask; mask >>= 1)
-      dst->item(BIT_MARK_US, (byte & mask) ? BIT_ZERO_SPACE_US : BIT_ONE_SPACE_US);
+    CODEC.encode_bytes(dst, &byte, 1, true);
     // End of frame
     if (shift == 0) {
       // Append footer
@@ -56,28 +60,37 @@ void CoolixProtocol::encode(RemoteTransmitData *dst, const CoolixData &data) {
   }
 }
 
-static bool decode_frame(RemoteReceiveData &src, uint32_t &dst) {
+// Byte and inverted byte read with erasures, each fills in the bits the other could not decode
+static bool decode_repaired_byte(RemoteReceiveData &src, uint8_t &byte) {
+  auto normal = CODEC.decode_soft_bits(src, 8);
+  if (!normal.has_value())
+    return false;
+  auto inverted = CODEC.decode_soft_bits(src, 8);
+  if (!inverted.has_value())
+    return false;
+  auto value = normal->merge(*inverted, true);
+  if (!value.has_value())
+    return false;
+  byte = *value;
+  return true;
+}
+
+static bool decode_frame(RemoteReceiveData &src, uint32_t &dst, bool repair) {
   // Checking for header
-  if (!src.expect_item(HEADER_MARK_US, HEADER_SPACE_US))
+  if (!CODEC.decode_header(src))
     return false;
   // Reading data
   uint32_t data = 0;
   for (unsigned n = 3;; data <<= 8) {
-    // Reading byte
-    for (uint32_t mask = 1 << 7; mask; mask >>= 1) {
-      if (!src.expect_mark(BIT_MARK_US))
-        return false;
-      if (src.expect_space(BIT_ONE_SPACE_US)) {
-        data |= mask;
-      } else if (!src.expect_space(BIT_ZERO_SPACE_US)) {
-        return false;
-      }
-    }
-    // Checking for inverted byte
-    for (uint32_t mask = 1 << 7; mask; mask >>= 1) {
-      if (!src.expect_item(BIT_MARK_US, (data & mask) ? BIT_ZERO_SPACE_US : BIT_ONE_SPACE_US))
+    // Reading byte, followed by its inverse
+    uint8_t byte;
+    if (repair) {
+      if (!decode_repaired_byte(src, byte))
         return false;
+    } else if (!CODEC.decode_bytes(src, &byte, 1) || !CODEC.expect_bytes(src, &byte, 1, true)) {
+      return false;
     }
+    data |= byte;
     // End of frame
     if (--n == 0) {
       // Checking for footer
@@ -89,6 +102,18 @@ static bool decode_frame(RemoteReceiveData &src, uint32_t &dst) {
   }
 }
 
+// Strict first, with error correction enabled a frame that fails is read again with repaired bytes
+static bool decode_frame(RemoteReceiveData &src, uint32_t &dst) {
+  const uint32_t start = src.get_index();
+  if (decode_frame(src, dst, false))
+    return true;
+  if (!src.is_error_correcting())
+    return false;
+  src.reset();
+  src.advance(start);
+  return decode_frame(src, dst, true);
+}
+
 optional<CoolixData> CoolixProtocol::decode(RemoteReceiveData data) {
   CoolixData result;
   const auto size = data.size();
@@ -111,3 +136,5 @@ void CoolixProtocol::dump(const CoolixData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_COOLIX
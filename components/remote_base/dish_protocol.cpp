@@ -1,6 +1,8 @@
 #include "dish_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_DISH
+
 namespace esphome {
 namespace remote_base {
 
@@ -11,6 +13,7 @@ static const uint32_t HEADER_LOW_US = 6100;
 static const uint32_t BIT_HIGH_US = 400;
 static const uint32_t BIT_ONE_LOW_US = 1700;
 static const uint32_t BIT_ZERO_LOW_US = 2800;
+static const BitTiming BIT_TIMING{BIT_HIGH_US, BIT_ONE_LOW_US, BIT_HIGH_US, BIT_ZERO_LOW_US};
 
 void DishProtocol::encode(RemoteTransmitData *dst, const DishData &data) {
   dst->reserve(138);
@@ -23,25 +26,11 @@ void DishProtocol::encode(RemoteTransmitData *dst, const DishData &data) {
   //  at least 4 times to accept it.
   for (uint i = 0; i < 4; i++) {
     // COMMAND (function, in MSB)
-    for (uint8_t mask = 1UL << 5; mask; mask >>= 1) {
-      if (data.command & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
-
+    dst->append_bits(data.command, 6, BIT_ORDER_MSB_FIRST, BIT_TIMING);
     // ADDRESS (unit code, in LSB)
-    for (uint8_t mask = 1UL; mask < 1UL << 4; mask <<= 1) {
-      if ((data.address - 1) & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
+    dst->append_bits(data.address - 1, 4, BIT_ORDER_LSB_FIRST, BIT_TIMING);
     // PADDING
-    for (uint j = 0; j < 6; j++)
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
+    dst->append_bits(0, 6, BIT_ORDER_LSB_FIRST, BIT_TIMING);
 
     // FOOTER
     dst->item(HEADER_HIGH_US, HEADER_LOW_US);
@@ -55,25 +44,15 @@ optional<DishData> DishProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
 
-  for (uint8_t mask = 1UL << 5; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      data.command |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      data.command &= ~mask;
-    } else {
-      return {};
-    }
-  }
+  auto command = src.read_bits(6, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!command.has_value())
+    return {};
+  data.command = *command;
 
-  for (uint8_t mask = 1UL; mask < 1UL << 5; mask <<= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      data.address |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      data.address &= ~mask;
-    } else {
-      return {};
-    }
-  }
+  auto address = src.read_bits(5, BIT_ORDER_LSB_FIRST, BIT_TIMING);
+  if (!address.has_value())
+    return {};
+  data.address = *address;
   for (uint j = 0; j < 6; j++) {
     if (!src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
       return {};
@@ -92,3 +71,5 @@ void DishProtocol::dump(const DishData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_DISH
@@ -10,16 +10,17 @@ struct DishData {
   uint8_t command;
 
   bool operator==(const DishData &rhs) const { return address == rhs.address && command == rhs.command; }
+  uint64_t index_key() const { return (address << 8) | command; }
 };
 
-class DishProtocol : public RemoteProtocol<DishData> {
+class DishProtocol : public StaticRemoteProtocol<DishData> {
  public:
-  void encode(RemoteTransmitData *dst, const DishData &data) override;
-  optional<DishData> decode(RemoteReceiveData src) override;
-  void dump(const DishData &data) override;
+  void encode(RemoteTransmitData *dst, const DishData &data);
+  optional<DishData> decode(RemoteReceiveData src);
+  void dump(const DishData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(Dish)
+DECLARE_INDEXED_REMOTE_PROTOCOL(Dish)
 
 template<typename... Ts> class DishAction : public RemoteTransmitterActionBase<Ts...> {
  public:
@@ -1,6 +1,8 @@
 #include "dooya_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_DOOYA
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,6 +14,7 @@ static const uint32_t BIT_ZERO_HIGH_US = 350;
 static const uint32_t BIT_ZERO_LOW_US = 750;
 static const uint32_t BIT_ONE_HIGH_US = 750;
 static const uint32_t BIT_ONE_LOW_US = 350;
+static const BitTiming BIT_TIMING{BIT_ONE_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US};
 
 void DooyaProtocol::encode(RemoteTransmitData *dst, const DooyaData &data) {
   dst->set_carrier_frequency(0);
@@ -19,37 +22,10 @@ void DooyaProtocol::encode(RemoteTransmitData *dst, const DooyaData &data) {
 
   dst->item(HEADER_HIGH_US, HEADER_LOW_US);
 
-  for (uint32_t mask = 1UL << (23); mask != 0; mask >>= 1) {
-    if (data.id & mask) {
-      dst->item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (uint32_t mask = 1UL << (7); mask != 0; mask >>= 1) {
-    if (data.channel & mask) {
-      dst->item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (uint32_t mask = 1UL << (3); mask != 0; mask >>= 1) {
-    if (data.button & mask) {
-      dst->item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (uint32_t mask = 1UL << (3); mask != 0; mask >>= 1) {
-    if (data.check & mask) {
-      dst->item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  dst->append_bits(data.id, 24, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  dst->append_bits(data.channel, 8, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  dst->append_bits(data.button, 4, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  dst->append_bits(data.check, 4, BIT_ORDER_MSB_FIRST, BIT_TIMING);
 }
 optional<DooyaData> DooyaProtocol::decode(RemoteReceiveData src) {
   DooyaData out{
@@ -61,45 +37,14 @@ optional<DooyaData> DooyaProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
 
-  for (uint8_t i = 0; i < 24; i++) {
-    if (src.expect_item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US)) {
-      out.id = (out.id << 1) | 1;
-    } else if (src.expect_item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.id = (out.id << 1) | 0;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint8_t i = 0; i < 8; i++) {
-    if (src.expect_item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US)) {
-      out.channel = (out.channel << 1) | 1;
-    } else if (src.expect_item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.channel = (out.channel << 1) | 0;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint8_t i = 0; i < 4; i++) {
-    if (src.expect_item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US)) {
-      out.button = (out.button << 1) | 1;
-    } else if (src.expect_item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.button = (out.button << 1) | 0;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint8_t i = 0; i < 3; i++) {
-    if (src.expect_item(BIT_ONE_HIGH_US, BIT_ONE_LOW_US)) {
-      out.check = (out.check << 1) | 1;
-    } else if (src.expect_item(BIT_ZERO_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.check = (out.check << 1) | 0;
-    } else {
-      return {};
-    }
-  }
+  // id, channel, button and the first three check bits in one read
+  auto bits = src.read_bits(24 + 8 + 4 + 3, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!bits.has_value())
+    return {};
+  out.id = *bits >> 15;
+  out.channel = (*bits >> 7) & 0xFF;
+  out.button = (*bits >> 3) & 0x0F;
+  out.check = *bits & 0x07;
   // Last bit is not received properly but can be decoded
   if (src.expect_mark(BIT_ONE_HIGH_US)) {
     out.check = (out.check << 1) | 1;
@@ -118,3 +63,5 @@ void DooyaProtocol::dump(const DooyaData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_DOOYA
@@ -17,16 +17,17 @@ struct DooyaData {
   bool operator==(const DooyaData &rhs) const {
     return id == rhs.id && channel == rhs.channel && button == rhs.button && check == rhs.check;
   }
+  uint64_t index_key() const { return (uint64_t(id) << 24) | (channel << 16) | (button << 8) | check; }
 };
 
-class DooyaProtocol : public RemoteProtocol<DooyaData> {
+class DooyaProtocol : public StaticRemoteProtocol<DooyaData> {
  public:
-  void encode(RemoteTransmitData *dst, const DooyaData &data) override;
-  optional<DooyaData> decode(RemoteReceiveData src) override;
-  void dump(const DooyaData &data) override;
+  void encode(RemoteTransmitData *dst, const DooyaData &data);
+  optional<DooyaData> decode(RemoteReceiveData src);
+  void dump(const DooyaData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(Dooya)
+DECLARE_INDEXED_REMOTE_PROTOCOL(Dooya)
 
 template<typename... Ts> class DooyaAction : public RemoteTransmitterActionBase<Ts...> {
  public:
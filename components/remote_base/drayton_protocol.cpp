@@ -1,8 +1,11 @@
 #include "drayton_protocol.h"
+#include "bi_phase.h"
 #include "esphome/core/log.h"
 
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_DRAYTON
+
 namespace esphome {
 namespace remote_base {
 
@@ -18,6 +21,9 @@ static const uint8_t NBITS_COMMAND = 7;
 static const uint8_t NDATABITS = NBITS_ADDRESS + NBITS_CHANNEL + NBITS_COMMAND;
 static const uint8_t MIN_RX_SRC = (NDATABITS + NBITS_SYNC / 2);
 
+// The sync symbol followed by a '0' bit gives a space of three bit times
+static const BiPhaseCodec BI_PHASE(BIT_TIME_US, 3);
+
 static const uint8_t CMD_ON = 0x41;
 static const uint8_t CMD_OFF = 0x02;
 
@@ -89,29 +95,17 @@ void DraytonProtocol::encode(RemoteTransmitData *dst, const DraytonData &data) {
   uint16_t khz = CARRIER_KHZ;
   dst->set_carrier_frequency(khz * 1000);
 
-  // Preamble = 101010101010
-  uint32_t out_data = 0x0AAA;
-  for (uint32_t mask = 1UL << (NBITS_PREAMBLE - 1); mask != 0; mask >>= 1) {
-    if (out_data & mask) {
-      dst->mark(BIT_TIME_US);
-    } else {
-      dst->space(BIT_TIME_US);
-    }
-  }
+  BiPhaseWriter writer = BI_PHASE.writer(dst);
+  // Preamble = 101010101010, the levels of '1' bits
+  writer.push_bits(0x3F, NBITS_PREAMBLE / 2);
 
   // Sync = 1100
-  out_data = 0x000C;
-  for (uint32_t mask = 1UL << (NBITS_SYNC - 1); mask != 0; mask >>= 1) {
-    if (out_data & mask) {
-      dst->mark(BIT_TIME_US);
-    } else {
-      dst->space(BIT_TIME_US);
-    }
-  }
+  writer.push(true, NBITS_SYNC / 2);
+  writer.push(false, NBITS_SYNC / 2);
 
   ESP_LOGD(TAG, "Send Drayton: address=%04x channel=%03x cmd=%02x", data.address, data.channel, data.command);
 
-  out_data = data.address;
+  uint32_t out_data = data.address;
   out_data <<= NBITS_COMMAND;
   out_data |= data.command;
   out_data <<= NBITS_CHANNEL;
@@ -119,15 +113,8 @@ void DraytonProtocol::encode(RemoteTransmitData *dst, const DraytonData &data) {
 
   ESP_LOGV(TAG, "Send Drayton: out_data %08" PRIx32, out_data);
 
-  for (uint32_t mask = 1UL << (NDATABITS - 1); mask != 0; mask >>= 1) {
-    if (out_data & mask) {
-      dst->mark(BIT_TIME_US);
-      dst->space(BIT_TIME_US);
-    } else {
-      dst->space(BIT_TIME_US);
-      dst->mark(BIT_TIME_US);
-    }
-  }
+  writer.push_bits(out_data, NDATABITS);
+  writer.flush();
 }
 
 optional<DraytonData> DraytonProtocol::decode(RemoteReceiveData src) {
@@ -137,97 +124,50 @@ optional<DraytonData> DraytonProtocol::decode(RemoteReceiveData src) {
       .command = 0,
   };
 
+  const BiPhaseWindows windows = BI_PHASE.windows(src);
+  BiPhaseLevels levels;
   while (src.size() - src.get_index() >= MIN_RX_SRC) {
-    ESP_LOGVV(TAG,
-              "Decode Drayton: %" PRId32 ", %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32
-              " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32
-              " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 " %" PRId32 "",
-              src.size() - src.get_index(), src.peek(0), src.peek(1), src.peek(2), src.peek(3), src.peek(4),
-              src.peek(5), src.peek(6), src.peek(7), src.peek(8), src.peek(9), src.peek(10), src.peek(11), src.peek(12),
-              src.peek(13), src.peek(14), src.peek(15), src.peek(16), src.peek(17), src.peek(18), src.peek(19));
-
-    // If first preamble item is a space, skip it
-    if (src.peek_space_at_least(1)) {
+    // A packet starts with a mark of one (preamble) or two (sync) bit times, anything else is skipped without
+    // expanding it. This also skips a leading space of the preamble.
+    const int32_t first = src.peek();
+    if (first < windows.lo[0] || first > windows.hi[1]) {
       src.advance(1);
-    }
-
-    // Look for sync pulse, after. If sucessful index points to space of sync symbol
-    while (src.size() - src.get_index() >= MIN_RX_SRC) {
-      ESP_LOGVV(TAG, "Decode Drayton: sync search %" PRIu32 ", %" PRId32 " %" PRId32, src.size() - src.get_index(),
-                src.peek(), src.peek(1));
-      if (src.peek_mark(2 * BIT_TIME_US) &&
-          (src.peek_space(2 * BIT_TIME_US, 1) || src.peek_space(3 * BIT_TIME_US, 1))) {
-        src.advance(1);
-        ESP_LOGVV(TAG, "Decode Drayton: Found SYNC, - %" PRIu32, src.get_index());
-        break;
-      } else {
-        src.advance(2);
-      }
-    }
-
-    // No point continuing if not enough samples remaining to complete a packet
-    if (src.size() - src.get_index() < NDATABITS) {
-      ESP_LOGV(TAG, "Decode Drayton: Fail 1, - %" PRIu32, src.get_index());
-      break;
-    }
-
-    // Read data. Index points to space of sync symbol
-    // Extract first bit
-    // Checks next bit to leave index pointing correctly
-    uint32_t out_data = 0;
-    uint8_t bit = NDATABITS - 1;
-    ESP_LOGVV(TAG, "Decode Drayton: first bit %" PRId32 "  %" PRId32 ", %" PRId32, src.peek(0), src.peek(1),
-              src.peek(2));
-    if (src.expect_space(3 * BIT_TIME_US) && (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) {
-      out_data |= 0 << bit;
-    } else if (src.expect_space(2 * BIT_TIME_US) && src.expect_mark(BIT_TIME_US) &&
-               (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) {
-      out_data |= 1 << bit;
-    } else {
-      ESP_LOGV(TAG, "Decode Drayton: Fail 2, - %" PRId32 " %" PRId32 " %" PRId32, src.peek(-1), src.peek(0),
-               src.peek(1));
       continue;
     }
 
-    // Before/after each bit is read the index points to the transition at the start of the bit period or,
-    // if there is no transition at the start of the bit period, then the transition in the middle of
-    // the previous bit period.
-    while (--bit >= 1) {
-      ESP_LOGVV(TAG, "Decode Drayton: Data, %2d %08" PRIx32, bit, out_data);
-      if ((src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) &&
-          (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) {
-        out_data |= 0 << bit;
-      } else if ((src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) &&
-                 (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) {
-        out_data |= 1 << bit;
-      } else {
-        break;
-      }
-    }
-
-    if (bit > 0) {
-      ESP_LOGVV(TAG, "Decode Drayton: Fail 3, %" PRId32 " %" PRId32 " %" PRId32, src.peek(-1), src.peek(0),
-                src.peek(1));
-      continue;
+    // Levels up to the first mark or space that is not a multiple of the bit time
+    levels.clear();
+    const uint16_t count = BI_PHASE.expand(src, windows, levels);
+    if (count == 0) {
+      src.advance(1);
     }
-
-    if (src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) {
-      out_data |= 0;
-    } else if (src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) {
-      out_data |= 1;
-    } else {
+    if (count < NBITS_SYNC + 2 * NDATABITS) {
       continue;
     }
+    ESP_LOGVV(TAG, "Decode Drayton: %" PRIu16 " levels up to %" PRIu32, levels.size(), src.get_index());
+
+    // The preamble alternates, the sync symbol is the first '1100' followed by a complete packet
+    for (uint16_t index = 0; index + NBITS_SYNC + 2 * NDATABITS <= levels.size(); index++) {
+      if (!levels.get(index) || !levels.get(index + 1) || levels.get(index + 2) || levels.get(index + 3))
+        continue;
+      ESP_LOGVV(TAG, "Decode Drayton: Found SYNC, - %" PRIu16, index);
+
+      uint32_t out_data;
+      if (!levels.decode_bits(index + NBITS_SYNC, NDATABITS, out_data)) {
+        ESP_LOGVV(TAG, "Decode Drayton: Fail, - %" PRIu16, index);
+        continue;
+      }
 
-    ESP_LOGV(TAG, "Decode Drayton: Data, %2d %08" PRIx32, bit, out_data);
+      ESP_LOGV(TAG, "Decode Drayton: Data, %08" PRIx32, out_data);
 
-    out.channel = (uint8_t) (out_data & 0x1F);
-    out_data >>= NBITS_CHANNEL;
-    out.command = (uint8_t) (out_data & 0x7F);
-    out_data >>= NBITS_COMMAND;
-    out.address = (uint16_t) (out_data & 0xFFFF);
+      out.channel = (uint8_t) (out_data & 0x1F);
+      out_data >>= NBITS_CHANNEL;
+      out.command = (uint8_t) (out_data & 0x7F);
+      out_data >>= NBITS_COMMAND;
+      out.address = (uint16_t) (out_data & 0xFFFF);
 
-    return out;
+      return out;
+    }
   }
   return {};
 }
@@ -238,3 +178,5 @@ void DraytonProtocol::dump(const DraytonData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_DRAYTON
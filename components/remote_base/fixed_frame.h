@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace remote_base {
+
+enum FieldEncoding : uint8_t {
+  /// Plain unsigned value
+  FIELD_ENCODING_BINARY = 0,
+  /// Units in the low nibble, tens in the bits above it
+  FIELD_ENCODING_BCD = 1,
+};
+
+/// A field of Width bits starting at bit Shift of byte Byte of a fixed-length frame. Fields do not cross bytes, a
+/// value spread over several bytes is declared as one field per byte.
+template<uint8_t Byte, uint8_t Shift, uint8_t Width, FieldEncoding Encoding = FIELD_ENCODING_BINARY> struct FrameField {
+  static_assert(Width > 0 && Shift + Width <= 8, "a field lives inside one byte");
+  static_assert(Encoding != FIELD_ENCODING_BCD || Width > 4, "a BCD field holds at least a units nibble");
+  static constexpr uint8_t BYTE = Byte;
+  static constexpr uint8_t SHIFT = Shift;
+  static constexpr uint8_t MASK = (1u << Width) - 1u;
+
+  static constexpr uint8_t encode(uint8_t value) {
+    return (Encoding == FIELD_ENCODING_BCD ? ((value / 10) << 4) | (value % 10) : value) & MASK;
+  }
+  static constexpr uint8_t decode(uint8_t raw) {
+    return Encoding == FIELD_ENCODING_BCD ? (raw >> 4) * 10 + (raw & 0x0F) : raw;
+  }
+};
+
+/// Fixed-length frame of an AC protocol. Fields are read and written through FrameField declarations, so every
+/// accessor is a constant mask and shift. Checksum names the field holding the checksum and computes it:
+///
+///   struct Checksum {
+///     using Field = FrameField<...>;
+///     static uint8_t calc(const uint8_t *data);
+///   };
+///
+/// Bytes before the checksum byte are the payload operator== compares.
+template<size_t N, typename Checksum> class FixedFrame {
+ public:
+  static constexpr uint8_t OFFSET_CS = Checksum::Field::BYTE;
+  static_assert(OFFSET_CS < N, "the checksum lives inside the frame");
+
+  FixedFrame() = default;
+  FixedFrame(std::initializer_list<uint8_t> data) {
+    std::copy_n(data.begin(), std::min(data.size(), this->data_.size()), this->data_.begin());
+  }
+  FixedFrame(const std::vector<uint8_t> &data) {
+    std::copy_n(data.begin(), std::min(data.size(), this->data_.size()), this->data_.begin());
+  }
+
+  uint8_t *data() { return this->data_.data(); }
+  const uint8_t *data() const { return this->data_.data(); }
+  uint8_t size() const { return this->data_.size(); }
+  bool is_valid() const { return this->get<typename Checksum::Field>() == Checksum::calc(this->data_.data()); }
+  void finalize() { this->set<typename Checksum::Field>(Checksum::calc(this->data_.data())); }
+  bool is_compliment(const FixedFrame &rhs) const {
+    return std::equal(this->data_.begin(), this->data_.end(), rhs.data_.begin(),
+                      [](const uint8_t &a, const uint8_t &b) { return a + b == 255; });
+  }
+  std::string to_string() const { return format_hex_pretty(this->data_.data(), this->data_.size()); }
+  bool operator==(const FixedFrame &rhs) const {
+    return std::equal(this->data_.begin(), this->data_.begin() + OFFSET_CS, rhs.data_.begin());
+  }
+  uint8_t &operator[](size_t idx) { return this->data_[idx]; }
+  const uint8_t &operator[](size_t idx) const { return this->data_[idx]; }
+
+  template<typename Field> uint8_t get() const {
+    return Field::decode((this->data_[Field::BYTE] >> Field::SHIFT) & Field::MASK);
+  }
+  template<typename Field> void set(uint8_t value) {
+    this->data_[Field::BYTE] =
+        (this->data_[Field::BYTE] & ~(Field::MASK << Field::SHIFT)) | (Field::encode(value) << Field::SHIFT);
+  }
+
+ protected:
+  // Runtime field access for frames whose layout is not declared with FrameField
+  uint8_t get_value_(uint8_t idx, uint8_t mask = 255, uint8_t shift = 0) const {
+    return (this->data_[idx] >> shift) & mask;
+  }
+  void set_value_(uint8_t idx, uint8_t value, uint8_t mask = 255, uint8_t shift = 0) {
+    this->data_[idx] &= ~(mask << shift);
+    this->data_[idx] |= (value << shift);
+  }
+  void set_mask_(uint8_t idx, bool state, uint8_t mask = 255) { this->set_value_(idx, state ? mask : 0, mask); }
+
+  std::array<uint8_t, N> data_{};
+};
+
+}  // namespace remote_base
+}  // namespace esphome
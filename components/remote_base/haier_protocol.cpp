@@ -1,6 +1,8 @@
 #include "haier_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_HAIER
+
 namespace esphome {
 namespace remote_base {
 
@@ -11,7 +13,15 @@ constexpr uint32_t HEADER_HIGH_US = 4400;
 constexpr uint32_t BIT_MARK_US = 540;
 constexpr uint32_t BIT_ONE_SPACE_US = 1650;
 constexpr uint32_t BIT_ZERO_SPACE_US = 580;
-constexpr unsigned int HAIER_IR_PACKET_BIT_SIZE = 112;
+constexpr unsigned int HAIER_IR_PACKET_BIT_SIZE = (HAIER_DATA_LENGTH + 1) * 8;
+
+bool HaierProtocol::check_data_length(size_t length) {
+  if (length <= HAIER_DATA_LENGTH)
+    return true;
+  ESP_LOGE(TAG, "Code of %u bytes is longer than the %u a Haier frame holds, not sending", (unsigned) length,
+           (unsigned) HAIER_DATA_LENGTH);
+  return false;
+}
 
 void HaierProtocol::encode_byte_(RemoteTransmitData *dst, uint8_t item) {
   for (uint8_t mask = 1 << 7; mask != 0; mask >>= 1) {
@@ -82,3 +92,5 @@ void HaierProtocol::dump(const HaierData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_HAIER
@@ -6,17 +6,22 @@
 namespace esphome {
 namespace remote_base {
 
+/// Payload of a Haier frame in bytes, the checksum byte that follows is not stored.
+static const uint8_t HAIER_DATA_LENGTH = 13;
+
 struct HaierData {
-  std::vector<uint8_t> data;
+  InlineBuffer<uint8_t, HAIER_DATA_LENGTH> data;
 
   bool operator==(const HaierData &rhs) const { return data == rhs.data; }
 };
 
-class HaierProtocol : public RemoteProtocol<HaierData> {
+class HaierProtocol : public StaticRemoteProtocol<HaierData> {
  public:
-  void encode(RemoteTransmitData *dst, const HaierData &data) override;
-  optional<HaierData> decode(RemoteReceiveData src) override;
-  void dump(const HaierData &data) override;
+  void encode(RemoteTransmitData *dst, const HaierData &data);
+  optional<HaierData> decode(RemoteReceiveData src);
+  void dump(const HaierData &data);
+  /// Logs and returns false if a code of length bytes does not fit into HaierData.
+  static bool check_data_length(size_t length);
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t item);
@@ -29,8 +34,11 @@ template<typename... Ts> class HaierAction : public RemoteTransmitterActionBase<
   TEMPLATABLE_VALUE(std::vector<uint8_t>, code)
 
   void encode(RemoteTransmitData *dst, Ts... x) override {
+    const auto code = this->code_.value(x...);
+    if (!HaierProtocol::check_data_length(code.size()))
+      return;
     HaierData data{};
-    data.data = this->code_.value(x...);
+    data.data = code;
     HaierProtocol().encode(dst, data);
   }
 };
@@ -0,0 +1,27 @@
+#include "hash_protocol.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+#ifdef USE_REMOTE_BASE_HASH
+
+namespace esphome {
+namespace remote_base {
+
+static const char *const TAG = "remote.hash";
+
+// Shorter frames are noise bursts rather than button presses
+static const int32_t MIN_TIMINGS = 8;
+
+optional<HashData> HashProtocol::decode(RemoteReceiveData src) {
+  if (src.size() < MIN_TIMINGS)
+    return {};
+  return HashData{src.get_pattern_hash()};
+}
+
+void HashProtocol::dump(const HashData &data) { ESP_LOGI(TAG, "Received Hash: hash=0x%08" PRIX32, data.hash); }
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_HASH
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "remote_base.h"
+
+namespace esphome {
+namespace remote_base {
+
+struct HashData {
+  uint32_t hash;
+
+  bool operator==(const HashData &rhs) const { return hash == rhs.hash; }
+  uint64_t index_key() const { return hash; }
+};
+
+/// Fallback for remotes no protocol decodes. A frame is reduced to the timing_pattern_hash() of its marks and spaces,
+/// so a button costs four bytes and one compare instead of the full timings raw matching needs. A hash cannot be
+/// turned back into a frame, there is no action.
+class HashProtocol : public StaticRemoteProtocol<HashData> {
+ public:
+  optional<HashData> decode(RemoteReceiveData src);
+  void dump(const HashData &data);
+};
+
+using HashBinarySensor = RemoteReceiverIndexedBinarySensor<HashProtocol>;
+using HashTrigger = RemoteReceiverTrigger<HashProtocol>;
+
+/// Only logs frames none of the protocol dumpers recognized, like the raw dumper.
+class HashDumper : public RemoteReceiverDumper<HashProtocol> {
+ public:
+  bool is_secondary() override { return true; }
+};
+
+}  // namespace remote_base
+}  // namespace esphome
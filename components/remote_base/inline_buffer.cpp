@@ -0,0 +1,13 @@
+#include "inline_buffer.h"
+
+namespace esphome {
+namespace remote_base {
+
+static uint32_t overflows = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+uint32_t inline_buffer_overflows() { return overflows; }
+
+void inline_buffer_count_overflow(size_t count) { overflows += count; }
+
+}  // namespace remote_base
+}  // namespace esphome
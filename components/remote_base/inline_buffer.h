@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace remote_base {
+
+/// Number of values dropped by any InlineBuffer because it was full.
+uint32_t inline_buffer_overflows();
+void inline_buffer_count_overflow(size_t count);
+
+/// Fixed capacity replacement for the subset of std::vector used on the receive and transmit paths. Storage lives
+/// inside the object, so filling, copying and clearing a buffer never touches the heap. Values written beyond the
+/// capacity are dropped and counted in inline_buffer_overflows(), the frame is truncated instead of growing.
+template<typename T, size_t N> class InlineBuffer {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  InlineBuffer() = default;
+  InlineBuffer(std::initializer_list<T> values) { this->assign(values.begin(), values.end()); }
+  template<typename It> InlineBuffer(It first, It last) { this->assign(first, last); }
+  InlineBuffer(const InlineBuffer &other) { this->assign(other.begin(), other.end()); }
+  InlineBuffer &operator=(const InlineBuffer &other) {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+  /// Lets templated lambdas and other callers keep handing in std::vector.
+  InlineBuffer(const std::vector<T> &values) { this->assign(values.begin(), values.end()); }  // NOLINT
+  /// And keep taking it out as one, e.g. format_hex_pretty(x.data) in a trigger lambda.
+  operator std::vector<T>() const { return std::vector<T>(this->begin(), this->end()); }  // NOLINT
+
+  size_t size() const { return this->size_; }
+  static constexpr size_t capacity() { return N; }
+  static constexpr size_t max_size() { return N; }
+  bool empty() const { return this->size_ == 0; }
+  T *data() { return this->data_; }
+  const T *data() const { return this->data_; }
+
+  T &operator[](size_t index) { return this->data_[index]; }
+  const T &operator[](size_t index) const { return this->data_[index]; }
+  T &front() { return this->data_[0]; }
+  const T &front() const { return this->data_[0]; }
+  T &back() { return this->data_[this->size_ - 1]; }
+  const T &back() const { return this->data_[this->size_ - 1]; }
+
+  iterator begin() { return this->data_; }
+  iterator end() { return this->data_ + this->size_; }
+  const_iterator begin() const { return this->data_; }
+  const_iterator end() const { return this->data_ + this->size_; }
+
+  void push_back(const T &value) {
+    if (this->size_ == N) {
+      inline_buffer_count_overflow(1);
+      return;
+    }
+    this->data_[this->size_++] = value;
+  }
+  template<typename... Args> void emplace_back(Args &&...args) { this->push_back(T(std::forward<Args>(args)...)); }
+  void pop_back() { this->size_--; }
+  void clear() { this->size_ = 0; }
+  /// Storage is fixed, kept so callers can size a std::vector and an InlineBuffer the same way.
+  void reserve(size_t /*size*/) {}
+  void resize(size_t size, const T &value = T()) {
+    if (size > N) {
+      inline_buffer_count_overflow(size - N);
+      size = N;
+    }
+    if (size > this->size_)
+      std::fill(this->data_ + this->size_, this->data_ + size, value);
+    this->size_ = size;
+  }
+
+  template<typename It> void assign(It first, It last) {
+    this->size_ = 0;
+    this->insert(this->end(), first, last);
+  }
+  void assign(std::initializer_list<T> values) { this->assign(values.begin(), values.end()); }
+
+  iterator insert(const_iterator pos, const T &value) {
+    // value may live in this buffer and move while making room
+    const T copy = value;
+    return this->insert(pos, &copy, &copy + 1);
+  }
+  iterator insert(const_iterator pos, std::initializer_list<T> values) {
+    return this->insert(pos, values.begin(), values.end());
+  }
+  /// Values that do not fit are dropped from the end of the buffer, the inserted range is kept whole where possible.
+  template<typename It> iterator insert(const_iterator pos, It first, It last) {
+    const size_t offset = pos - this->data_;
+    const size_t count = std::distance(first, last);
+    const size_t fits = std::min(count, N - offset);
+    // Values after pos that still fit once the range is in place
+    const size_t kept = std::min(this->size_ - offset, N - offset - fits);
+    if (count + this->size_ > N)
+      inline_buffer_count_overflow(count + this->size_ - N);
+    std::move_backward(this->data_ + offset, this->data_ + offset + kept, this->data_ + offset + fits + kept);
+    std::copy_n(first, fits, this->data_ + offset);
+    this->size_ = offset + fits + kept;
+    return this->data_ + offset;
+  }
+
+  bool operator==(const InlineBuffer &rhs) const {
+    return this->size_ == rhs.size_ && std::equal(this->begin(), this->end(), rhs.begin());
+  }
+  bool operator!=(const InlineBuffer &rhs) const { return !(*this == rhs); }
+
+ protected:
+  size_t size_{0};
+  T data_[N];
+};
+
+}  // namespace remote_base
+}  // namespace esphome
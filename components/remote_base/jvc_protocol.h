@@ -11,16 +11,17 @@ struct JVCData {
   uint32_t data;
 
   bool operator==(const JVCData &rhs) const { return data == rhs.data; }
+  uint64_t index_key() const { return data; }
 };
 
-class JVCProtocol : public RemoteProtocol<JVCData> {
+class JVCProtocol : public StaticRemoteProtocol<JVCData> {
  public:
-  void encode(RemoteTransmitData *dst, const JVCData &data) override;
-  optional<JVCData> decode(RemoteReceiveData src) override;
-  void dump(const JVCData &data) override;
+  void encode(RemoteTransmitData *dst, const JVCData &data);
+  optional<JVCData> decode(RemoteReceiveData src);
+  void dump(const JVCData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(JVC)
+DECLARE_INDEXED_REMOTE_PROTOCOL(JVC)
 
 template<typename... Ts> class JVCAction : public RemoteTransmitterActionBase<Ts...> {
  public:
@@ -3,6 +3,8 @@
 
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_KEELOQ
+
 namespace esphome {
 namespace remote_base {
 
@@ -21,6 +23,8 @@ static const uint8_t NBITS_FIXED_DATA = NBITS_REPEAT + NBITS_VLOW + NBITS_BUTTON
 static const uint8_t NBITS_ENCRYPTED_DATA = NBITS_BUTTONS + NBITS_DISC + NBITS_SYNC_CNT;
 static const uint8_t NBITS_DATA = NBITS_FIXED_DATA + NBITS_ENCRYPTED_DATA;
 
+static const BitTiming BIT_TIMING{1 * BIT_TIME_US, 2 * BIT_TIME_US, 2 * BIT_TIME_US, 1 * BIT_TIME_US};
+
 /*
 KeeLoq Protocol
 
@@ -54,15 +58,7 @@ void KeeloqProtocol::encode(RemoteTransmitData *dst, const KeeloqData &data) {
 
   ESP_LOGV(TAG, "Send Keeloq: Encrypted data %04" PRIx32, out_data);
 
-  for (uint32_t mask = 1, cnt = 0; cnt < NBITS_ENCRYPTED_DATA; cnt++, mask <<= 1) {
-    if (out_data & mask) {
-      dst->mark(1 * BIT_TIME_US);
-      dst->space(2 * BIT_TIME_US);
-    } else {
-      dst->mark(2 * BIT_TIME_US);
-      dst->space(1 * BIT_TIME_US);
-    }
-  }
+  dst->append_bits(out_data, NBITS_ENCRYPTED_DATA, BIT_ORDER_LSB_FIRST, BIT_TIMING);
 
   // first 32 bits of fixed portion
   out_data = (data.command & 0x0f);
@@ -70,28 +66,9 @@ void KeeloqProtocol::encode(RemoteTransmitData *dst, const KeeloqData &data) {
   out_data |= data.address;
   ESP_LOGV(TAG, "Send Keeloq: Fixed data %04" PRIx32, out_data);
 
-  for (uint32_t mask = 1, cnt = 0; cnt < (NBITS_FIXED_DATA - 2); cnt++, mask <<= 1) {
-    if (out_data & mask) {
-      dst->mark(1 * BIT_TIME_US);
-      dst->space(2 * BIT_TIME_US);
-    } else {
-      dst->mark(2 * BIT_TIME_US);
-      dst->space(1 * BIT_TIME_US);
-    }
-  }
-
-  // low battery flag
-  if (data.vlow) {
-    dst->mark(1 * BIT_TIME_US);
-    dst->space(2 * BIT_TIME_US);
-  } else {
-    dst->mark(2 * BIT_TIME_US);
-    dst->space(1 * BIT_TIME_US);
-  }
-
-  // repeat flag - always sent as a '1'
-  dst->mark(1 * BIT_TIME_US);
-  dst->space(2 * BIT_TIME_US);
+  // followed by the low battery flag and the repeat flag, always sent as a '1'
+  const uint64_t fixed = out_data | (uint64_t(data.vlow) << (NBITS_FIXED_DATA - 2)) | (1ULL << (NBITS_FIXED_DATA - 1));
+  dst->append_bits(fixed, NBITS_FIXED_DATA, BIT_ORDER_LSB_FIRST, BIT_TIMING);
 
   // Guard time  at end of packet
   dst->space(39 * BIT_TIME_US);
@@ -133,45 +110,24 @@ optional<KeeloqData> KeeloqProtocol::decode(RemoteReceiveData src) {
   }
 
   // Read encrypted bits
-  uint32_t out_data = 0;
-  for (bit = 0; bit < NBITS_ENCRYPTED_DATA; bit++) {
-    if (src.expect_mark(2 * BIT_TIME_US) && src.expect_space(BIT_TIME_US)) {
-      out_data |= 0 << bit;
-    } else if (src.expect_mark(BIT_TIME_US) && src.expect_space(2 * BIT_TIME_US)) {
-      out_data |= 1 << bit;
-    } else {
-      ESP_LOGV(TAG, "Decode KeeLoq: Fail 2, %" PRIu32 " %" PRId32, src.get_index(), src.peek());
-      return {};
-    }
-  }
-  ESP_LOGVV(TAG, "Decode KeeLoq: Data, %d %08" PRIx32, bit, out_data);
-  out.encrypted = out_data;
-
-  // Read Serial Number and Button Status
-  out_data = 0;
-  for (bit = 0; bit < NBITS_SERIAL + NBITS_BUTTONS; bit++) {
-    if (src.expect_mark(2 * BIT_TIME_US) && src.expect_space(BIT_TIME_US)) {
-      out_data |= 0 << bit;
-    } else if (src.expect_mark(BIT_TIME_US) && src.expect_space(2 * BIT_TIME_US)) {
-      out_data |= 1 << bit;
-    } else {
-      ESP_LOGV(TAG, "Decode KeeLoq: Fail 3, %" PRIu32 " %" PRId32, src.get_index(), src.peek());
-      return {};
-    }
+  auto encrypted = src.read_bits(NBITS_ENCRYPTED_DATA, BIT_ORDER_LSB_FIRST, BIT_TIMING);
+  if (!encrypted.has_value()) {
+    ESP_LOGV(TAG, "Decode KeeLoq: Fail 2, %" PRIu32 " %" PRId32, src.get_index(), src.peek());
+    return {};
   }
-  ESP_LOGVV(TAG, "Decode KeeLoq: Data, %2d %08" PRIx32, bit, out_data);
-  out.command = (out_data >> 28) & 0xf;
-  out.address = out_data & 0xfffffff;
-
-  // Read Vlow bit
-  if (src.expect_mark(2 * BIT_TIME_US) && src.expect_space(BIT_TIME_US)) {
-    out.vlow = false;
-  } else if (src.expect_mark(BIT_TIME_US) && src.expect_space(2 * BIT_TIME_US)) {
-    out.vlow = true;
-  } else {
-    ESP_LOGV(TAG, "Decode KeeLoq: Fail 4, %" PRId32, src.peek());
+  out.encrypted = *encrypted;
+  ESP_LOGVV(TAG, "Decode KeeLoq: Data, %08" PRIx32, out.encrypted);
+
+  // Read Serial Number, Button Status and Vlow bit
+  auto fixed = src.read_bits(NBITS_SERIAL + NBITS_BUTTONS + NBITS_VLOW, BIT_ORDER_LSB_FIRST, BIT_TIMING);
+  if (!fixed.has_value()) {
+    ESP_LOGV(TAG, "Decode KeeLoq: Fail 3, %" PRIu32 " %" PRId32, src.get_index(), src.peek());
     return {};
   }
+  ESP_LOGVV(TAG, "Decode KeeLoq: Data, %09" PRIx64, *fixed);
+  out.command = (*fixed >> 28) & 0xf;
+  out.address = *fixed & 0xfffffff;
+  out.vlow = (*fixed >> 32) & 1;
 
   // Read Repeat bit
   if (src.expect_mark(2 * BIT_TIME_US) && src.peek_space_at_least(BIT_TIME_US)) {
@@ -192,3 +148,5 @@ void KeeloqProtocol::dump(const KeeloqData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_KEELOQ
@@ -1,6 +1,9 @@
 #include "lg_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_LG
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,19 +15,15 @@ static const uint32_t BIT_HIGH_US = 600;
 static const uint32_t BIT_ONE_LOW_US = 1600;
 static const uint32_t BIT_ZERO_LOW_US = 550;
 
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_MSB_FIRST});
+
 void LGProtocol::encode(RemoteTransmitData *dst, const LGData &data) {
   dst->set_carrier_frequency(38000);
   dst->reserve(2 + data.nbits * 2u);
 
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-
-  for (uint32_t mask = 1UL << (data.nbits - 1); mask != 0; mask >>= 1) {
-    if (data.data & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_bits(dst, data.data, data.nbits);
 
   dst->mark(BIT_HIGH_US);
 }
@@ -33,21 +32,14 @@ optional<LGData> LGProtocol::decode(RemoteReceiveData src) {
       .data = 0,
       .nbits = 0,
   };
-  if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
+  if (!CODEC.decode_header(src))
     return {};
 
-  for (out.nbits = 0; out.nbits < 32; out.nbits++) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.data = (out.data << 1) | 1;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.data = (out.data << 1) | 0;
-    } else if (out.nbits == 28) {
-      return out;
-    } else {
-      return {};
-    }
-  }
-
+  uint64_t data;
+  out.nbits = CODEC.decode_bits_up_to(src, data, 32);
+  if (out.nbits != 32 && out.nbits != 28)
+    return {};
+  out.data = data;
   return out;
 }
 void LGProtocol::dump(const LGData &data) {
@@ -56,3 +48,5 @@ void LGProtocol::dump(const LGData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_LG
@@ -13,16 +13,17 @@ struct LGData {
   uint8_t nbits;
 
   bool operator==(const LGData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
+  uint64_t index_key() const { return (uint64_t(nbits) << 32) | data; }
 };
 
-class LGProtocol : public RemoteProtocol<LGData> {
+class LGProtocol : public StaticRemoteProtocol<LGData> {
  public:
-  void encode(RemoteTransmitData *dst, const LGData &data) override;
-  optional<LGData> decode(RemoteReceiveData src) override;
-  void dump(const LGData &data) override;
+  void encode(RemoteTransmitData *dst, const LGData &data);
+  optional<LGData> decode(RemoteReceiveData src);
+  void dump(const LGData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(LG)
+DECLARE_INDEXED_REMOTE_PROTOCOL(LG)
 
 template<typename... Ts> class LGAction : public RemoteTransmitterActionBase<Ts...> {
  public:
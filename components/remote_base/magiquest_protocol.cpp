@@ -5,6 +5,8 @@
  * https://arduino-irremote.github.io/Arduino-IRremote/ir__MagiQuest_8cpp_source.html
  */
 
+#ifdef USE_REMOTE_BASE_MAGIQUEST
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,6 +17,8 @@ static const uint32_t MAGIQUEST_ONE_MARK = 2 * MAGIQUEST_UNIT;
 static const uint32_t MAGIQUEST_ONE_SPACE = 2 * MAGIQUEST_UNIT;
 static const uint32_t MAGIQUEST_ZERO_MARK = MAGIQUEST_UNIT;
 static const uint32_t MAGIQUEST_ZERO_SPACE = 3 * MAGIQUEST_UNIT;
+static const BitTiming MAGIQUEST_BIT{MAGIQUEST_ONE_MARK, MAGIQUEST_ONE_SPACE, MAGIQUEST_ZERO_MARK,
+                                     MAGIQUEST_ZERO_SPACE};
 
 void MagiQuestProtocol::encode(RemoteTransmitData *dst, const MagiQuestData &data) {
   dst->reserve(101);  // 2 start bits, 48 data bits, 1 stop bit
@@ -23,21 +27,8 @@ void MagiQuestProtocol::encode(RemoteTransmitData *dst, const MagiQuestData &dat
   // 2 start bits
   dst->item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE);
   dst->item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE);
-  for (uint32_t mask = 1 << 31; mask; mask >>= 1) {
-    if (data.wand_id & mask) {
-      dst->item(MAGIQUEST_ONE_MARK, MAGIQUEST_ONE_SPACE);
-    } else {
-      dst->item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE);
-    }
-  }
-
-  for (uint16_t mask = 1 << 15; mask; mask >>= 1) {
-    if (data.magnitude & mask) {
-      dst->item(MAGIQUEST_ONE_MARK, MAGIQUEST_ONE_SPACE);
-    } else {
-      dst->item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE);
-    }
-  }
+  dst->append_bits(data.wand_id, 32, BIT_ORDER_MSB_FIRST, MAGIQUEST_BIT);
+  dst->append_bits(data.magnitude, 16, BIT_ORDER_MSB_FIRST, MAGIQUEST_BIT);
 
   dst->mark(MAGIQUEST_UNIT);
 }
@@ -52,25 +43,14 @@ optional<MagiQuestData> MagiQuestProtocol::decode(RemoteReceiveData src) {
     return {};
   }
 
-  for (uint32_t mask = 1 << 31; mask; mask >>= 1) {
-    if (src.expect_item(MAGIQUEST_ONE_MARK, MAGIQUEST_ONE_SPACE)) {
-      data.wand_id |= mask;
-    } else if (src.expect_item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE)) {
-      data.wand_id &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint16_t mask = 1 << 15; mask; mask >>= 1) {
-    if (src.expect_item(MAGIQUEST_ONE_MARK, MAGIQUEST_ONE_SPACE)) {
-      data.magnitude |= mask;
-    } else if (src.expect_item(MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE)) {
-      data.magnitude &= ~mask;
-    } else {
-      return {};
-    }
-  }
+  auto wand_id = src.read_bits(32, BIT_ORDER_MSB_FIRST, MAGIQUEST_BIT);
+  if (!wand_id.has_value())
+    return {};
+  auto magnitude = src.read_bits(16, BIT_ORDER_MSB_FIRST, MAGIQUEST_BIT);
+  if (!magnitude.has_value())
+    return {};
+  data.wand_id = *wand_id;
+  data.magnitude = *magnitude;
 
   src.expect_mark(MAGIQUEST_UNIT);
   return data;
@@ -81,3 +61,5 @@ void MagiQuestProtocol::dump(const MagiQuestData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_MAGIQUEST
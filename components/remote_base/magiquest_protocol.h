@@ -24,16 +24,18 @@ struct MagiQuestData {
     }
     return (this->wand_id == 0xffff || rhs.wand_id == 0xffff || this->wand_id == rhs.wand_id);
   }
+  // The wildcard magnitude is left out so it shares the key of every magnitude
+  uint64_t index_key() const { return wand_id; }
 };
 
-class MagiQuestProtocol : public RemoteProtocol<MagiQuestData> {
+class MagiQuestProtocol : public StaticRemoteProtocol<MagiQuestData> {
  public:
-  void encode(RemoteTransmitData *dst, const MagiQuestData &data) override;
-  optional<MagiQuestData> decode(RemoteReceiveData src) override;
-  void dump(const MagiQuestData &data) override;
+  void encode(RemoteTransmitData *dst, const MagiQuestData &data);
+  optional<MagiQuestData> decode(RemoteReceiveData src);
+  void dump(const MagiQuestData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(MagiQuest)
+DECLARE_INDEXED_REMOTE_PROTOCOL(MagiQuest)
 
 template<typename... Ts> class MagiQuestAction : public RemoteTransmitterActionBase<Ts...> {
  public:
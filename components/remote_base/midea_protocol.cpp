@@ -1,6 +1,9 @@
 #include "midea_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_MIDEA
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,62 +18,65 @@ static const int32_t BIT_ZERO_SPACE_US = 1 * TICK_US;
 static const int32_t FOOTER_MARK_US = 1 * TICK_US;
 static const int32_t FOOTER_SPACE_US = 10 * TICK_US;
 
-uint8_t MideaData::calc_cs_() const {
+static constexpr PulseDistanceCodec CODEC({HEADER_MARK_US, HEADER_SPACE_US, BIT_MARK_US, BIT_ONE_SPACE_US,
+                                           BIT_ZERO_SPACE_US, BIT_ORDER_MSB_FIRST});
+
+uint8_t MideaChecksum::calc(const uint8_t *data) {
   uint8_t cs = 0;
-  for (uint8_t idx = 0; idx < OFFSET_CS; idx++)
-    cs -= reverse_bits(this->data_[idx]);
+  for (uint8_t idx = 0; idx < Field::BYTE; idx++)
+    cs -= reverse_bits(data[idx]);
   return reverse_bits(cs);
 }
 
-bool MideaData::is_compliment(const MideaData &rhs) const {
-  return std::equal(this->data_.begin(), this->data_.end(), rhs.data_.begin(),
-                    [](const uint8_t &a, const uint8_t &b) { return a + b == 255; });
-}
-
 void MideaProtocol::encode(RemoteTransmitData *dst, const MideaData &src) {
   dst->set_carrier_frequency(38000);
   dst->reserve(2 + 48 * 2 + 2 + 2 + 48 * 2 + 1);
-  dst->item(HEADER_MARK_US, HEADER_SPACE_US);
-  for (unsigned idx = 0; idx < 6; idx++) {
-    for (uint8_t mask = 1 << 7; mask; mask >>= 1)
-      dst->item(BIT_MARK_US, (src[idx] & mask) ? BIT_ONE_SPACE_US : BIT_ZERO_SPACE_US);
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_frame(dst, src);
   dst->item(FOOTER_MARK_US, FOOTER_SPACE_US);
-  dst->item(HEADER_MARK_US, HEADER_SPACE_US);
-  for (unsigned idx = 0; idx < 6; idx++) {
-    for (uint8_t mask = 1 << 7; mask; mask >>= 1)
-      dst->item(BIT_MARK_US, (src[idx] & mask) ? BIT_ZERO_SPACE_US : BIT_ONE_SPACE_US);
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_frame(dst, src, true);
   dst->mark(FOOTER_MARK_US);
 }
 
-static bool decode_data(RemoteReceiveData &src, MideaData &dst) {
-  for (unsigned idx = 0; idx < 6; idx++) {
-    uint8_t data = 0;
-    for (uint8_t mask = 1 << 7; mask; mask >>= 1) {
-      if (!src.expect_mark(BIT_MARK_US))
-        return false;
-      if (src.expect_space(BIT_ONE_SPACE_US)) {
-        data |= mask;
-      } else if (!src.expect_space(BIT_ZERO_SPACE_US)) {
-        return false;
-      }
-    }
-    dst[idx] = data;
-  }
-  return true;
+// Frame and complement read with erasures, each fills in the bits the other could not decode
+static optional<MideaData> decode_repaired(RemoteReceiveData &src) {
+  static const uint8_t NBITS = 48;
+  if (!CODEC.decode_header(src))
+    return {};
+  auto frame = CODEC.decode_soft_bits(src, NBITS);
+  if (!frame.has_value() || !src.expect_item(FOOTER_MARK_US, FOOTER_SPACE_US) || !CODEC.decode_header(src))
+    return {};
+  auto complement = CODEC.decode_soft_bits(src, NBITS);
+  if (!complement.has_value() || !src.expect_mark(FOOTER_MARK_US))
+    return {};
+  auto bits = frame->merge(*complement, true);
+  if (!bits.has_value())
+    return {};
+  MideaData out;
+  for (uint8_t idx = 0; idx < out.size(); idx++)
+    out[idx] = *bits >> (NBITS - 8 * (idx + 1));
+  if (!out.is_valid())
+    return {};
+  ESP_LOGV(TAG, "Repaired %d bits", __builtin_popcountll(frame->erasures | complement->erasures));
+  return out;
 }
 
 optional<MideaData> MideaProtocol::decode(RemoteReceiveData src) {
-  MideaData out, inv;
-  if (src.expect_item(HEADER_MARK_US, HEADER_SPACE_US) && decode_data(src, out) && out.is_valid() &&
-      src.expect_item(FOOTER_MARK_US, FOOTER_SPACE_US) && src.expect_item(HEADER_MARK_US, HEADER_SPACE_US) &&
-      decode_data(src, inv) && src.expect_mark(FOOTER_MARK_US) && out.is_compliment(inv))
+  MideaData out;
+  if (CODEC.decode_header(src) && CODEC.decode_frame(src, out) && src.expect_item(FOOTER_MARK_US, FOOTER_SPACE_US) &&
+      CODEC.decode_header(src) && CODEC.expect_bytes(src, out.data(), out.size(), true) &&
+      src.expect_mark(FOOTER_MARK_US))
     return out;
-  return {};
+  if (!src.is_error_correcting())
+    return {};
+  src.reset();
+  return decode_repaired(src);
 }
 
 void MideaProtocol::dump(const MideaData &data) { ESP_LOGI(TAG, "Received Midea: %s", data.to_string().c_str()); }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_MIDEA
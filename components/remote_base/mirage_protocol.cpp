@@ -1,6 +1,8 @@
 #include "mirage_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_MIRAGE
+
 namespace esphome {
 namespace remote_base {
 
@@ -82,3 +84,5 @@ void MirageProtocol::dump(const MirageData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_MIRAGE
@@ -12,11 +12,11 @@ struct MirageData {
   bool operator==(const MirageData &rhs) const { return data == rhs.data; }
 };
 
-class MirageProtocol : public RemoteProtocol<MirageData> {
+class MirageProtocol : public StaticRemoteProtocol<MirageData> {
  public:
-  void encode(RemoteTransmitData *dst, const MirageData &data) override;
-  optional<MirageData> decode(RemoteReceiveData src) override;
-  void dump(const MirageData &data) override;
+  void encode(RemoteTransmitData *dst, const MirageData &data);
+  optional<MirageData> decode(RemoteReceiveData src);
+  void dump(const MirageData &data);
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t item);
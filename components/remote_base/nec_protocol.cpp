@@ -1,6 +1,9 @@
 #include "nec_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_NEC
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,6 +15,9 @@ static const uint32_t BIT_HIGH_US = 560;
 static const uint32_t BIT_ONE_LOW_US = 1690;
 static const uint32_t BIT_ZERO_LOW_US = 560;
 
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_LSB_FIRST});
+
 void NECProtocol::encode(RemoteTransmitData *dst, const NECData &data) {
   ESP_LOGD(TAG, "Sending NEC: address=0x%04X, command=0x%04X command_repeats=%d", data.address, data.command,
            data.command_repeats);
@@ -19,25 +25,10 @@ void NECProtocol::encode(RemoteTransmitData *dst, const NECData &data) {
   dst->reserve(2 + 32 + 32 * data.command_repeats + 2);
   dst->set_carrier_frequency(38000);
 
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-
-  for (uint16_t mask = 1; mask; mask <<= 1) {
-    if (data.address & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (uint16_t repeats = 0; repeats < data.command_repeats; repeats++) {
-    for (uint16_t mask = 1; mask; mask <<= 1) {
-      if (data.command & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_bits(dst, data.address, 16);
+  for (uint16_t repeats = 0; repeats < data.command_repeats; repeats++)
+    CODEC.encode_bits(dst, data.command, 16);
 
   dst->mark(BIT_HIGH_US);
 }
@@ -47,48 +38,13 @@ optional<NECData> NECProtocol::decode(RemoteReceiveData src) {
       .command = 0,
       .command_repeats = 1,
   };
-  if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
+  if (!CODEC.decode_header(src) || !CODEC.decode_bits(src, data.address, 16) ||
+      !CODEC.decode_bits(src, data.command, 16))
     return {};
 
-  for (uint16_t mask = 1; mask; mask <<= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      data.address |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      data.address &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint16_t mask = 1; mask; mask <<= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      data.command |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      data.command &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  while (src.peek_item(BIT_HIGH_US, BIT_ONE_LOW_US) || src.peek_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-    uint16_t command = 0;
-    for (uint16_t mask = 1; mask; mask <<= 1) {
-      if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-        command |= mask;
-      } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-        command &= ~mask;
-      } else {
-        return {};
-      }
-    }
-
-    // Make sure the extra/repeated data matches original command
-    if (command != data.command) {
-      return {};
-    }
-
-    data.command_repeats += 1;
-  }
+  // Make sure the extra/repeated data matches original command
+  if (!CODEC.decode_repeats(src, data.command, 16, data.command_repeats))
+    return {};
 
   src.expect_mark(BIT_HIGH_US);
   return data;
@@ -100,3 +56,5 @@ void NECProtocol::dump(const NECData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_NEC
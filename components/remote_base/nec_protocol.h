@@ -11,16 +11,17 @@ struct NECData {
   uint16_t command_repeats;
 
   bool operator==(const NECData &rhs) const { return address == rhs.address && command == rhs.command; }
+  uint64_t index_key() const { return (uint32_t(address) << 16) | command; }
 };
 
-class NECProtocol : public RemoteProtocol<NECData> {
+class NECProtocol : public StaticRemoteProtocol<NECData> {
  public:
-  void encode(RemoteTransmitData *dst, const NECData &data) override;
-  optional<NECData> decode(RemoteReceiveData src) override;
-  void dump(const NECData &data) override;
+  void encode(RemoteTransmitData *dst, const NECData &data);
+  optional<NECData> decode(RemoteReceiveData src);
+  void dump(const NECData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(NEC)
+DECLARE_INDEXED_REMOTE_PROTOCOL(NEC)
 
 template<typename... Ts> class NECAction : public RemoteTransmitterActionBase<Ts...> {
  public:
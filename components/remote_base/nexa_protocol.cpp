@@ -1,6 +1,9 @@
 #include "nexa_protocol.h"
+#include "bi_phase.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_NEXA
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,6 +15,8 @@ static const uint32_t HEADER_LOW_US = 2610;
 static const uint32_t BIT_HIGH_US = 319;
 static const uint32_t BIT_ONE_LOW_US = 1000;
 static const uint32_t BIT_ZERO_LOW_US = 140;
+// Symbols of a frame with the optional level
+static const uint16_t NSYMBOLS_LEVEL = 2 * (NBITS + 4);
 
 static const uint32_t TX_HEADER_HIGH_US = 250;
 static const uint32_t TX_HEADER_LOW_US = TX_HEADER_HIGH_US * 10;
@@ -123,110 +128,56 @@ optional<NexaData> NexaProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_pulse_with_gap(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
 
-  // Device
-  for (uint8_t i = 0; i < 26; i++) {
-    out.device <<= 1UL;
-    if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US) &&
-        (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US))) {
-      // '1' => '10'
-      out.device |= 0x01;
-    } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US) &&
-               (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US))) {
-      // '0' => '01'
-      out.device |= 0x00;
-    } else {
-      // This should not happen...failed command
-      return {};
-    }
+  // Every bit is sent as two symbols, '1' => '10' and '0' => '01', like the half-bits of a bi-phase code. Same
+  // acceptance as expect_pulse_with_gap(), with the bounds worked out once instead of for every symbol.
+  const int32_t mark_lo = src.lower_bound(BIT_HIGH_US);
+  const int32_t mark_hi = src.upper_bound(BIT_HIGH_US);
+  const int32_t one_lo = src.lower_bound(BIT_ONE_LOW_US);
+  const int32_t zero_lo = src.lower_bound(BIT_ZERO_LOW_US);
+  const int32_t *data = src.get_raw_data().data() + src.get_index();
+  const uint32_t count = (src.size() - src.get_index()) / 2;
+  BiPhaseLevels symbols;
+  for (uint32_t index = 0; index < count && symbols.size() < NSYMBOLS_LEVEL; index++) {
+    const int32_t mark = data[2 * index];
+    const int32_t gap = -data[2 * index + 1];
+    if (mark < 0 || mark < mark_lo || mark > mark_hi || gap < 0 || gap < zero_lo)
+      break;
+    if (src.is_tracking_deviation())
+      src.note_deviation(mark, BIT_HIGH_US);
+    symbols.push(gap >= one_lo);
   }
 
+  uint32_t value;
+  // Device
+  if (!symbols.decode_bits(0, 26, value))
+    return {};
+  out.device = value;
+
   // GROUP
-  for (uint8_t i = 0; i < 1; i++) {
-    out.group <<= 1UL;
-    if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US) &&
-        (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US))) {
-      // '1' => '10'
-      out.group |= 0x01;
-    } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US) &&
-               (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US))) {
-      // '0' => '01'
-      out.group |= 0x00;
-    } else {
-      // This should not happen...failed command
-      return {};
-    }
-  }
+  if (!symbols.decode_bits(52, 1, value))
+    return {};
+  out.group = value;
 
-  // STATE
-  for (uint8_t i = 0; i < 1; i++) {
-    out.state <<= 1UL;
-
-    // Special treatment as we should handle 01, 10 and 00
-    // We need to care for the advance made in the expect functions
-    // hence take them one at a time so that we do not get out of sync
-    // in decoding
-
-    if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      // Starts with '1'
-      if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-        // '10' => 1
-        out.state |= 0x01;
-      } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-        // '11' => NOT OK
-        // This case is here to make sure we advance through the correct index
-        // This should not happen...failed command
-        return {};
-      }
-    } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      // Starts with '0'
-      if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-        // '01' => 0
-        out.state |= 0x00;
-      } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-        // '00' => Special case for dimmer! => 2
-        out.state |= 0x02;
-      }
-    }
+  // STATE, '00' is the special case for dimmers => 2
+  if (symbols.size() < 56)
+    return {};
+  if (!symbols.get(54) && !symbols.get(55)) {
+    out.state = 2;
+  } else if (symbols.decode_bits(54, 1, value)) {
+    out.state = value;
+  } else {
+    // '11' => NOT OK
+    return {};
   }
 
   // CHANNEL (EE and BB bits)
-  for (uint8_t i = 0; i < 4; i++) {
-    out.channel <<= 1UL;
-    if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US) &&
-        (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US))) {
-      // '1' => '10'
-      out.channel |= 0x01;
-    } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US) &&
-               (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US))) {
-      // '0' => '01'
-      out.channel |= 0x00;
-    } else {
-      // This should not happen...failed command
-      return {};
-    }
-  }
-
-  // Optional to transmit LEVEL data (8 bits more)
-  if (int32_t(src.get_index() + 8) >= src.size()) {
-    return out;
-  }
+  if (!symbols.decode_bits(56, 4, value))
+    return {};
+  out.channel = value;
 
-  // LEVEL
-  for (uint8_t i = 0; i < 4; i++) {
-    out.level <<= 1UL;
-    if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US) &&
-        (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US))) {
-      // '1' => '10'
-      out.level |= 0x01;
-    } else if (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ZERO_LOW_US) &&
-               (src.expect_pulse_with_gap(BIT_HIGH_US, BIT_ONE_LOW_US))) {
-      // '0' => '01'
-      out.level |= 0x00;
-    } else {
-      // This should not happen...failed command
-      break;
-    }
-  }
+  // Optional to transmit LEVEL data (4 bits more)
+  if (symbols.decode_bits(64, 4, value))
+    out.level = value;
 
   return out;
 }
@@ -238,3 +189,5 @@ void NexaProtocol::dump(const NexaData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_NEXA
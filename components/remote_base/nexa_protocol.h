@@ -19,15 +19,15 @@ struct NexaData {
   }
 };
 
-class NexaProtocol : public RemoteProtocol<NexaData> {
+class NexaProtocol : public StaticRemoteProtocol<NexaData> {
  public:
   void one(RemoteTransmitData *dst) const;
   void zero(RemoteTransmitData *dst) const;
   void sync(RemoteTransmitData *dst) const;
 
-  void encode(RemoteTransmitData *dst, const NexaData &data) override;
-  optional<NexaData> decode(RemoteReceiveData src) override;
-  void dump(const NexaData &data) override;
+  void encode(RemoteTransmitData *dst, const NexaData &data);
+  optional<NexaData> decode(RemoteReceiveData src);
+  void dump(const NexaData &data);
 };
 
 DECLARE_REMOTE_PROTOCOL(Nexa)
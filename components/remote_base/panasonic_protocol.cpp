@@ -1,6 +1,9 @@
 #include "panasonic_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_PANASONIC
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,27 +15,16 @@ static const uint32_t BIT_HIGH_US = 502;
 static const uint32_t BIT_ZERO_LOW_US = 400;
 static const uint32_t BIT_ONE_LOW_US = 1244;
 
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_MSB_FIRST});
+
 void PanasonicProtocol::encode(RemoteTransmitData *dst, const PanasonicData &data) {
   dst->reserve(100);
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
+  CODEC.encode_header(dst);
   dst->set_carrier_frequency(35000);
 
-  uint32_t mask;
-  for (mask = 1UL << 15; mask != 0; mask >>= 1) {
-    if (data.address & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (mask = 1UL << 31; mask != 0; mask >>= 1) {
-    if (data.command & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  CODEC.encode_bits(dst, data.address, 16);
+  CODEC.encode_bits(dst, data.command, 32);
   dst->mark(BIT_HIGH_US);
 }
 optional<PanasonicData> PanasonicProtocol::decode(RemoteReceiveData src) {
@@ -40,30 +32,10 @@ optional<PanasonicData> PanasonicProtocol::decode(RemoteReceiveData src) {
       .address = 0,
       .command = 0,
   };
-  if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
+  if (!CODEC.decode_header(src) || !CODEC.decode_bits(src, out.address, 16) ||
+      !CODEC.decode_bits(src, out.command, 32))
     return {};
 
-  uint32_t mask;
-  for (mask = 1UL << 15; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.address |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.address &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  for (mask = 1UL << 31; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.command |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.command &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
   return out;
 }
 void PanasonicProtocol::dump(const PanasonicData &data) {
@@ -72,3 +44,5 @@ void PanasonicProtocol::dump(const PanasonicData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_PANASONIC
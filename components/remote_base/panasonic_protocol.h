@@ -13,16 +13,17 @@ struct PanasonicData {
   uint32_t command;
 
   bool operator==(const PanasonicData &rhs) const { return address == rhs.address && command == rhs.command; }
+  uint64_t index_key() const { return (uint64_t(address) << 32) | command; }
 };
 
-class PanasonicProtocol : public RemoteProtocol<PanasonicData> {
+class PanasonicProtocol : public StaticRemoteProtocol<PanasonicData> {
  public:
-  void encode(RemoteTransmitData *dst, const PanasonicData &data) override;
-  optional<PanasonicData> decode(RemoteReceiveData src) override;
-  void dump(const PanasonicData &data) override;
+  void encode(RemoteTransmitData *dst, const PanasonicData &data);
+  optional<PanasonicData> decode(RemoteReceiveData src);
+  void dump(const PanasonicData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(Panasonic)
+DECLARE_INDEXED_REMOTE_PROTOCOL(Panasonic)
 
 template<typename... Ts> class PanasonicAction : public RemoteTransmitterActionBase<Ts...> {
  public:
@@ -1,6 +1,8 @@
 #include "pioneer_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_PIONEER
+
 namespace esphome {
 namespace remote_base {
 
@@ -12,6 +14,7 @@ static const uint32_t BIT_HIGH_US = 560;
 static const uint32_t BIT_ONE_LOW_US = 1690;
 static const uint32_t BIT_ZERO_LOW_US = 560;
 static const uint32_t TRAILER_SPACE_US = 25500;
+static const BitTiming BIT_TIMING{BIT_HIGH_US, BIT_ONE_LOW_US, BIT_HIGH_US, BIT_ZERO_LOW_US};
 
 void PioneerProtocol::encode(RemoteTransmitData *dst, const PioneerData &data) {
   uint32_t address1 = ((data.rc_code_1 & 0xff00) | (~(data.rc_code_1 >> 8) & 0xff));
@@ -51,50 +54,19 @@ void PioneerProtocol::encode(RemoteTransmitData *dst, const PioneerData &data) {
   dst->set_carrier_frequency(40000);
 
   dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-  for (uint32_t mask = 1UL << 15; mask; mask >>= 1) {
-    if (address1 & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
-  for (uint32_t mask = 1UL << 15; mask; mask >>= 1) {
-    if (command1 & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
-
+  dst->append_bits(address1, 16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  dst->append_bits(command1, 16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
   dst->mark(BIT_HIGH_US);
 
   if (data.rc_code_2 != 0) {
     dst->space(TRAILER_SPACE_US);
     dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-    for (uint32_t mask = 1UL << 15; mask; mask >>= 1) {
-      if (address2 & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
-
-    for (uint32_t mask = 1UL << 15; mask; mask >>= 1) {
-      if (command2 & mask) {
-        dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-      } else {
-        dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-      }
-    }
-
+    dst->append_bits(address2, 16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+    dst->append_bits(command2, 16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
     dst->mark(BIT_HIGH_US);
   }
 }
 optional<PioneerData> PioneerProtocol::decode(RemoteReceiveData src) {
-  uint16_t address1 = 0;
-  uint16_t command1 = 0;
-
   PioneerData data{
       .rc_code_1 = 0,
       .rc_code_2 = 0,
@@ -102,25 +74,12 @@ optional<PioneerData> PioneerProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
 
-  for (uint32_t mask = 1UL << 15; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      address1 |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      address1 &= ~mask;
-    } else {
-      return {};
-    }
-  }
-
-  for (uint32_t mask = 1UL << 15; mask != 0; mask >>= 1) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      command1 |= mask;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      command1 &= ~mask;
-    } else {
-      return {};
-    }
-  }
+  // Address and command in one read, the address is the upper half
+  auto bits = src.read_bits(32, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!bits.has_value())
+    return {};
+  const uint16_t address1 = *bits >> 16;
+  const uint16_t command1 = *bits & 0xFFFF;
 
   if (!src.expect_mark(BIT_HIGH_US))
     return {};
@@ -154,3 +113,5 @@ void PioneerProtocol::dump(const PioneerData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_PIONEER
@@ -35,6 +35,8 @@
 #include "pronto_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_PRONTO
+
 namespace esphome {
 namespace remote_base {
 
@@ -244,3 +246,5 @@ void ProntoProtocol::dump(const ProntoData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_PRONTO
@@ -0,0 +1,143 @@
+#include "pulse_distance.h"
+
+#include <algorithm>
+
+#if defined(USE_HOST) && defined(__SSE2__)
+#include <emmintrin.h>
+#define REMOTE_BASE_PULSE_DISTANCE_SSE2
+#endif
+
+#ifdef USE_REMOTE_BASE_PULSE_DISTANCE
+
+namespace esphome {
+namespace remote_base {
+
+uint64_t classify_pulse_distance_bits(const int32_t *data, uint8_t npairs, const PulseDistanceWindows &windows,
+                                      uint64_t &ones) {
+  const PulseDistanceWindows &w = windows;
+  uint64_t valid = 0;
+  uint64_t one_bits = 0;
+  uint8_t pair = 0;
+#ifdef REMOTE_BASE_PULSE_DISTANCE_SSE2
+  // Two pairs per step, lanes are {mark, space, mark, space}
+  const __m128i one_lo = _mm_setr_epi32(w.mark_lo, w.one_lo, w.mark_lo, w.one_lo);
+  const __m128i one_hi = _mm_setr_epi32(w.mark_hi, w.one_hi, w.mark_hi, w.one_hi);
+  const __m128i zero_lo = _mm_setr_epi32(w.mark_lo, w.zero_lo, w.mark_lo, w.zero_lo);
+  const __m128i zero_hi = _mm_setr_epi32(w.mark_hi, w.zero_hi, w.mark_hi, w.zero_hi);
+  for (; pair + 2 <= npairs; pair += 2) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 2 * pair));
+    const __m128i one_out = _mm_or_si128(_mm_cmplt_epi32(v, one_lo), _mm_cmpgt_epi32(v, one_hi));
+    const __m128i zero_out = _mm_or_si128(_mm_cmplt_epi32(v, zero_lo), _mm_cmpgt_epi32(v, zero_hi));
+    const uint32_t one_ok = ~_mm_movemask_ps(_mm_castsi128_ps(one_out)) & 0xF;
+    const uint32_t zero_ok = ~_mm_movemask_ps(_mm_castsi128_ps(zero_out)) & 0xF;
+    // bit 0/2: mark of pair 0/1, bit 1/3: space of pair 0/1
+    const uint32_t space_ok = (one_ok | zero_ok) >> 1;
+    const uint32_t ok = one_ok & space_ok & 0x5;
+    const uint32_t one = (one_ok >> 1) & 0x5;
+    valid |= uint64_t((ok & 1) | ((ok >> 1) & 2)) << pair;
+    one_bits |= uint64_t((one & 1) | ((one >> 1) & 2)) << pair;
+  }
+#endif
+  for (; pair < npairs; pair++) {
+    const int32_t mark = data[2 * pair];
+    const int32_t space = data[2 * pair + 1];
+    const uint32_t mark_ok = (mark >= w.mark_lo) & (mark <= w.mark_hi);
+    const uint32_t one = (space >= w.one_lo) & (space <= w.one_hi);
+    const uint32_t zero = (space >= w.zero_lo) & (space <= w.zero_hi);
+    valid |= uint64_t(mark_ok & (one | zero)) << pair;
+    one_bits |= uint64_t(one) << pair;
+  }
+  ones = one_bits;
+  return valid;
+}
+
+PulseDistanceWindows PulseDistanceCodec::windows_(const RemoteReceiveData &src) const {
+  const PulseDistanceTiming &t = this->timing_;
+  // Same acceptance as peek_mark()/peek_space(): marks are >= 0, spaces <= 0
+  return {
+      .mark_lo = std::max(src.lower_bound(t.bit_mark), int32_t(0)),
+      .mark_hi = src.upper_bound(t.bit_mark),
+      .one_lo = -src.upper_bound(t.one_space),
+      .one_hi = std::min(-src.lower_bound(t.one_space), int32_t(0)),
+      .zero_lo = -src.upper_bound(t.zero_space),
+      .zero_hi = std::min(-src.lower_bound(t.zero_space), int32_t(0)),
+  };
+}
+
+void PulseDistanceCodec::encode_bits(RemoteTransmitData *dst, uint64_t value, uint8_t nbits) const {
+  dst->append_bits(value, nbits, this->timing_.bit_order, this->get_bit_timing());
+}
+
+void PulseDistanceCodec::encode_bytes(RemoteTransmitData *dst, const uint8_t *data, size_t len, bool invert) const {
+  const uint8_t mask = invert ? 0xFF : 0x00;
+  for (size_t idx = 0; idx < len; idx++)
+    this->encode_bits(dst, data[idx] ^ mask, 8);
+}
+
+bool PulseDistanceCodec::peek_bit(const RemoteReceiveData &src) const {
+  const PulseDistanceTiming &t = this->timing_;
+  return src.peek_mark(t.bit_mark) && (src.peek_space(t.one_space, 1) || src.peek_space(t.zero_space, 1));
+}
+
+uint8_t PulseDistanceCodec::decode_bits_up_to(RemoteReceiveData &src, uint64_t &value, uint8_t nbits) const {
+  value = 0;
+  const int32_t remaining = src.size() - int32_t(src.get_index());
+  if (remaining < 2 || nbits == 0)
+    return 0;
+  const uint8_t npairs = std::min<int32_t>(std::min<uint8_t>(nbits, 64), remaining / 2);
+  uint64_t ones;
+  const uint64_t valid =
+      classify_pulse_distance_bits(src.get_raw_data().data() + src.get_index(), npairs, this->windows_(src), ones);
+  // Bits are only taken up to the first pair that is not a bit
+  const uint8_t count = ~valid == 0 ? 64 : __builtin_ctzll(~valid);
+  const uint8_t nread = std::min(count, npairs);
+  if (nread == 0)
+    return 0;
+  const uint64_t mask = nread == 64 ? ~0ULL : (1ULL << nread) - 1;
+  ones &= mask;
+  value = this->timing_.bit_order == BIT_ORDER_MSB_FIRST ? reverse_bits_64(ones) >> (64 - nread) : ones;
+  if (src.is_tracking_deviation()) {
+    for (uint8_t bit = 0; bit < nread; bit++) {
+      src.note_deviation(src.peek(2 * bit), this->timing_.bit_mark);
+      src.note_deviation(src.peek(2 * bit + 1), (ones >> bit) & 1 ? this->timing_.one_space : this->timing_.zero_space);
+    }
+  }
+  src.advance(2 * nread);
+  return nread;
+}
+
+bool PulseDistanceCodec::decode_bytes(RemoteReceiveData &src, uint8_t *data, size_t len) const {
+  for (size_t idx = 0; idx < len; idx++) {
+    uint64_t value;
+    if (this->decode_bits_up_to(src, value, 8) != 8)
+      return false;
+    data[idx] = value;
+  }
+  return true;
+}
+
+bool PulseDistanceCodec::expect_bytes(RemoteReceiveData &src, const uint8_t *data, size_t len, bool invert) const {
+  const uint8_t mask = invert ? 0xFF : 0x00;
+  for (size_t idx = 0; idx < len; idx++) {
+    uint64_t value;
+    if (this->decode_bits_up_to(src, value, 8) != 8 || value != uint8_t(data[idx] ^ mask))
+      return false;
+  }
+  return true;
+}
+
+bool PulseDistanceCodec::decode_repeats(RemoteReceiveData &src, uint64_t expected, uint8_t nbits,
+                                        uint16_t &repeats) const {
+  while (this->peek_bit(src)) {
+    uint64_t value;
+    if (this->decode_bits_up_to(src, value, nbits) != nbits || value != expected)
+      return false;
+    repeats += 1;
+  }
+  return true;
+}
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_PULSE_DISTANCE
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "remote_base.h"
+
+#include <cstddef>
+
+namespace esphome {
+namespace remote_base {
+
+/// Timings of a pulse-distance coded protocol: every bit is a constant mark followed by a space whose
+/// length carries the bit value.
+struct PulseDistanceTiming {
+  uint32_t header_mark;
+  uint32_t header_space;
+  uint32_t bit_mark;
+  uint32_t one_space;
+  uint32_t zero_space;
+  BitOrder bit_order;
+};
+
+/// Signed acceptance windows for one mark/space pair, spaces are negative like in RawTimings.
+struct PulseDistanceWindows {
+  int32_t mark_lo;
+  int32_t mark_hi;
+  int32_t one_lo;
+  int32_t one_hi;
+  int32_t zero_lo;
+  int32_t zero_hi;
+};
+
+/// Classify npairs (at most 64) mark/space pairs in one branchless pass. Returns a mask with bit i set if pair i is a
+/// valid bit, ones gets bit i set if pair i is a one. Uses SSE2 on the host platform.
+uint64_t classify_pulse_distance_bits(const int32_t *data, uint8_t npairs, const PulseDistanceWindows &windows,
+                                      uint64_t &ones);
+
+/// Shared encoder/decoder for pulse-distance protocols (NEC, AEHA, York, Midea, Coolix, LG, Samsung, JVC,
+/// Panasonic). The protocol supplies its timings as a constexpr PulseDistanceTiming and keeps only its framing
+/// (footers, repeats, complement frames and integrity checks) in its own source file.
+class PulseDistanceCodec {
+ public:
+  constexpr PulseDistanceCodec(const PulseDistanceTiming &timing) : timing_(timing) {}
+
+  const PulseDistanceTiming &get_timing() const { return this->timing_; }
+  BitTiming get_bit_timing() const {
+    return {this->timing_.bit_mark, this->timing_.one_space, this->timing_.bit_mark, this->timing_.zero_space};
+  }
+
+  void encode_header(RemoteTransmitData *dst) const { dst->item(this->timing_.header_mark, this->timing_.header_space); }
+  /// Append the lowest nbits of value in the configured bit order.
+  void encode_bits(RemoteTransmitData *dst, uint64_t value, uint8_t nbits) const;
+  /// Append bytes in transmission order, optionally inverted (complement frames).
+  void encode_bytes(RemoteTransmitData *dst, const uint8_t *data, size_t len, bool invert = false) const;
+  /// Append a fixed length frame, see decode_frame().
+  template<typename Frame> void encode_frame(RemoteTransmitData *dst, const Frame &frame, bool invert = false) const {
+    this->encode_bytes(dst, frame.data(), frame.size(), invert);
+  }
+
+  bool decode_header(RemoteReceiveData &src) const {
+    return src.expect_item(this->timing_.header_mark, this->timing_.header_space);
+  }
+  /// True if the next item is a valid bit, nothing is consumed.
+  bool peek_bit(const RemoteReceiveData &src) const;
+  /// Read up to nbits bits into value and return how many were read. Reading stops without consuming anything at the first
+  /// item that is not a bit, so the caller can still check for a footer there.
+  uint8_t decode_bits_up_to(RemoteReceiveData &src, uint64_t &value, uint8_t nbits) const;
+  template<typename T> bool decode_bits(RemoteReceiveData &src, T &value, uint8_t nbits) const {
+    uint64_t tmp;
+    if (this->decode_bits_up_to(src, tmp, nbits) != nbits)
+      return false;
+    value = static_cast<T>(tmp);
+    return true;
+  }
+  bool decode_bytes(RemoteReceiveData &src, uint8_t *data, size_t len) const;
+  /// Check that the next bytes are a copy (or with invert the complement) of data.
+  bool expect_bytes(RemoteReceiveData &src, const uint8_t *data, size_t len, bool invert = false) const;
+  /// Read a fixed length frame. Frame provides data()/size() and its checksum policy through is_valid().
+  template<typename Frame> bool decode_frame(RemoteReceiveData &src, Frame &frame) const {
+    return this->decode_bytes(src, frame.data(), frame.size()) && frame.is_valid();
+  }
+  /// Read nbits bits, bits with one ambiguous edge come back as erasures, see RemoteReceiveData::read_soft_bits().
+  optional<SoftBits> decode_soft_bits(RemoteReceiveData &src, uint8_t nbits) const {
+    return src.read_soft_bits(nbits, this->timing_.bit_order, this->get_bit_timing());
+  }
+  /// Count trailing repeats of an nbits value. Fails if a repeat does not match expected.
+  bool decode_repeats(RemoteReceiveData &src, uint64_t expected, uint8_t nbits, uint16_t &repeats) const;
+
+ protected:
+  PulseDistanceWindows windows_(const RemoteReceiveData &src) const;
+
+  PulseDistanceTiming timing_;
+};
+
+}  // namespace remote_base
+}  // namespace esphome
@@ -1,6 +1,8 @@
 #include "raw_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_RAW
+
 namespace esphome {
 namespace remote_base {
 
@@ -45,3 +47,5 @@ bool RawDumper::dump(RemoteReceiveData src) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_RAW
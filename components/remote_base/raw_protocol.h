@@ -32,17 +32,23 @@ class RawBinarySensor : public RemoteReceiverBinarySensorBase {
   size_t len_;
 };
 
-class RawTrigger : public Trigger<RawTimings>, public Component, public RemoteReceiverListener {
+/// Automations always get a std::vector, whichever storage RawTimings uses.
+class RawTrigger : public Trigger<std::vector<int32_t>>, public Component, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+    const RawTimings &data = src.get_raw_data();
+    this->trigger(std::vector<int32_t>(data.begin(), data.end()));
+#else
     this->trigger(src.get_raw_data());
+#endif
     return false;
   }
 };
 
 template<typename... Ts> class RawAction : public RemoteTransmitterActionBase<Ts...> {
  public:
-  void set_code_template(std::function<RawTimings(Ts...)> func) { this->code_func_ = func; }
+  void set_code_template(std::function<std::vector<int32_t>(Ts...)> func) { this->code_func_ = func; }
   void set_code_static(const int32_t *code, size_t len) {
     this->code_static_ = code;
     this->code_static_len_ = len;
@@ -66,7 +72,7 @@ template<typename... Ts> class RawAction : public RemoteTransmitterActionBase<Ts
   }
 
  protected:
-  std::function<RawTimings(Ts...)> code_func_{nullptr};
+  std::function<std::vector<int32_t>(Ts...)> code_func_{nullptr};
   const int32_t *code_static_{nullptr};
   int32_t code_static_len_{0};
 };
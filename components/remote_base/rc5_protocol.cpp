@@ -1,6 +1,9 @@
 #include "rc5_protocol.h"
+#include "bi_phase.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_RC5
+
 namespace esphome {
 namespace remote_base {
 
@@ -8,6 +11,7 @@ static const char *const TAG = "remote.rc5";
 
 static const uint32_t BIT_TIME_US = 889;
 static const uint8_t NBITS = 14;
+static const BiPhaseCodec BI_PHASE(BIT_TIME_US);
 
 void RC5Protocol::encode(RemoteTransmitData *dst, const RC5Data &data) {
   static bool toggle = false;
@@ -25,15 +29,10 @@ void RC5Protocol::encode(RemoteTransmitData *dst, const RC5Data &data) {
   out_data |= data.address << 6;
   out_data |= command;
 
-  for (uint64_t mask = 1UL << (NBITS - 1); mask != 0; mask >>= 1) {
-    if (out_data & mask) {
-      dst->space(BIT_TIME_US);
-      dst->mark(BIT_TIME_US);
-    } else {
-      dst->mark(BIT_TIME_US);
-      dst->space(BIT_TIME_US);
-    }
-  }
+  // RC5 sends a 1 as space then mark, the inverse of the level pairs BiPhaseWriter uses
+  BiPhaseWriter writer = BI_PHASE.writer(dst);
+  writer.push_bits(~out_data, NBITS);
+  writer.flush();
   toggle = !toggle;
 }
 optional<RC5Data> RC5Protocol::decode(RemoteReceiveData src) {
@@ -41,42 +40,26 @@ optional<RC5Data> RC5Protocol::decode(RemoteReceiveData src) {
       .address = 0,
       .command = 0,
   };
-  uint8_t field_bit;
-
-  if (src.expect_space(BIT_TIME_US) && src.expect_mark(BIT_TIME_US)) {
-    field_bit = 1;
-  } else if (src.expect_space(2 * BIT_TIME_US)) {
-    field_bit = 0;
-  } else {
+  if (!src.is_valid(0))
     return {};
-  }
 
-  if (!(((src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US)) ||
-         (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) &&
-        (((src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) &&
-          (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) ||
-         ((src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) &&
-          (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US)))))) {
+  BiPhaseLevels levels;
+  // The first half of the start bit is a space, receivers usually drop it as part of the idle gap
+  if (src.peek() > 0)
+    levels.push(false);
+  BI_PHASE.expand(src, levels);
+  // One level more if the frame ends on a mark, see BiPhaseCodec::expand()
+  if (levels.size() != 2 * NBITS && levels.size() != 2 * NBITS + 1)
     return {};
-  }
 
-  uint32_t out_data = 0;
-  for (int bit = NBITS - 4; bit >= 1; bit--) {
-    if ((src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) &&
-        (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) {
-      out_data |= 0 << bit;
-    } else if ((src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) &&
-               (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) {
-      out_data |= 1 << bit;
-    } else {
-      return {};
-    }
-  }
-  if (src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) {
-    out_data |= 0;
-  } else if (src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) {
-    out_data |= 1;
-  }
+  uint32_t out_data;
+  if (!levels.decode_bits(0, NBITS, out_data))
+    return {};
+  out_data = ~out_data & ((1UL << NBITS) - 1);
+  // Start bit, the second one is the inverted seventh command bit
+  if ((out_data & (1UL << (NBITS - 1))) == 0)
+    return {};
+  const uint8_t field_bit = (out_data >> (NBITS - 2)) & 1;
 
   out.command = (uint8_t) (out_data & 0x3F) + (1 - field_bit) * 64u;
   out.address = (out_data >> 6) & 0x1F;
@@ -88,3 +71,5 @@ void RC5Protocol::dump(const RC5Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_RC5
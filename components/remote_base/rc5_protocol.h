@@ -11,16 +11,17 @@ struct RC5Data {
   uint8_t command;
 
   bool operator==(const RC5Data &rhs) const { return address == rhs.address && command == rhs.command; }
+  uint64_t index_key() const { return (address << 8) | command; }
 };
 
-class RC5Protocol : public RemoteProtocol<RC5Data> {
+class RC5Protocol : public StaticRemoteProtocol<RC5Data> {
  public:
-  void encode(RemoteTransmitData *dst, const RC5Data &data) override;
-  optional<RC5Data> decode(RemoteReceiveData src) override;
-  void dump(const RC5Data &data) override;
+  void encode(RemoteTransmitData *dst, const RC5Data &data);
+  optional<RC5Data> decode(RemoteReceiveData src);
+  void dump(const RC5Data &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(RC5)
+DECLARE_INDEXED_REMOTE_PROTOCOL(RC5)
 
 template<typename... Ts> class RC5Action : public RemoteTransmitterActionBase<Ts...> {
  public:
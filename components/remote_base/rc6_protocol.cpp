@@ -1,6 +1,9 @@
 #include "rc6_protocol.h"
+#include "bi_phase.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_RC6
+
 namespace esphome {
 namespace remote_base {
 
@@ -11,6 +14,11 @@ static const uint16_t RC6_UNIT = 444;
 static const uint16_t RC6_HEADER_MARK = (6 * RC6_UNIT);
 static const uint16_t RC6_HEADER_SPACE = (2 * RC6_UNIT);
 static const uint16_t RC6_MODE_MASK = 0x07;
+// Startbit, mode, toggle of double length and 16 data bits, in units
+static const uint16_t RC6_LEVELS = 2 + 3 * 2 + 4 + 16 * 2;
+
+// A double length toggle bit next to a bit with the same first level gives a mark or space of three units
+static const BiPhaseCodec BI_PHASE(RC6_UNIT, 3);
 
 void RC6Protocol::encode(RemoteTransmitData *dst, const RC6Data &data) {
   dst->reserve(44);
@@ -19,90 +27,15 @@ void RC6Protocol::encode(RemoteTransmitData *dst, const RC6Data &data) {
   // Encode header
   dst->item(RC6_HEADER_MARK, RC6_HEADER_SPACE);
 
-  int32_t next{0};
-
-  // Encode startbit+mode
-  uint8_t header{static_cast<uint8_t>((1 << 3) | data.mode)};
-
-  for (uint8_t mask = 0x8; mask; mask >>= 1) {
-    if (header & mask) {
-      if (next < 0) {
-        dst->space(-next);
-        next = 0;
-      }
-      if (next >= 0) {
-        next = next + RC6_UNIT;
-        dst->mark(next);
-        next = -RC6_UNIT;
-      }
-    } else {
-      if (next > 0) {
-        dst->mark(next);
-        next = 0;
-      }
-      if (next <= 0) {
-        next = next - RC6_UNIT;
-        dst->space(-next);
-        next = RC6_UNIT;
-      }
-    }
-  }
-
-  // Toggle
-  if (data.toggle) {
-    if (next < 0) {
-      dst->space(-next);
-      next = 0;
-    }
-    if (next >= 0) {
-      next = next + RC6_UNIT * 2;
-      dst->mark(next);
-      next = -RC6_UNIT * 2;
-    }
-  } else {
-    if (next > 0) {
-      dst->mark(next);
-      next = 0;
-    }
-    if (next <= 0) {
-      next = next - RC6_UNIT * 2;
-      dst->space(-next);
-      next = RC6_UNIT * 2;
-    }
-  }
-
-  // Encode data
-  uint16_t raw{static_cast<uint16_t>((data.address << 8) | data.command)};
-
-  for (uint16_t mask = 0x8000; mask; mask >>= 1) {
-    if (raw & mask) {
-      if (next < 0) {
-        dst->space(-next);
-        next = 0;
-      }
-      if (next >= 0) {
-        next = next + RC6_UNIT;
-        dst->mark(next);
-        next = -RC6_UNIT;
-      }
-    } else {
-      if (next > 0) {
-        dst->mark(next);
-        next = 0;
-      }
-      if (next <= 0) {
-        next = next - RC6_UNIT;
-        dst->space(-next);
-        next = RC6_UNIT;
-      }
-    }
-  }
-
-  if (next > 0) {
-    dst->mark(next);
-  } else {
-    dst->space(-next);
-  }
+  BiPhaseWriter writer = BI_PHASE.writer(dst);
+  // Startbit + mode
+  writer.push_bits((1 << 3) | data.mode, 4);
+  // Toggle, twice as long as the other bits
+  writer.push(data.toggle, 2);
+  writer.push(!data.toggle, 2);
+  // Data
+  writer.push_bits((data.address << 8) | data.command, 16);
+  writer.flush();
 }
 
 optional<RC6Data> RC6Protocol::decode(RemoteReceiveData src) {
@@ -118,26 +51,18 @@ optional<RC6Data> RC6Protocol::decode(RemoteReceiveData src) {
     return {};
   }
 
-  uint8_t bit{1};
-  uint8_t offset{0};
-  uint8_t header{0};
-  uint32_t buffer{0};
+  BiPhaseLevels levels;
+  BI_PHASE.expand(src, levels);
+  // One level more if the frame ends on a mark, see BiPhaseCodec::expand()
+  if (levels.size() != RC6_LEVELS && levels.size() != RC6_LEVELS + 1) {
+    return {};
+  }
 
   // Startbit + mode
-  while (offset < 4) {
-    bit = src.peek() > 0;
-    header = header + (bit << (3 - offset++));
-    src.advance();
-
-    if (src.peek_mark(RC6_UNIT) || src.peek_space(RC6_UNIT)) {
-      src.advance();
-    } else if (offset == 4) {
-      break;
-    } else if (!src.peek_mark(RC6_UNIT * 2) && !src.peek_space(RC6_UNIT * 2)) {
-      return {};
-    }
+  uint32_t header;
+  if (!levels.decode_bits(0, 4, header) || (header & 0x8) == 0) {
+    return {};
   }
-
   data.mode = header & RC6_MODE_MASK;
 
   if (data.mode != 0) {
@@ -145,26 +70,16 @@ optional<RC6Data> RC6Protocol::decode(RemoteReceiveData src) {
   }
 
   // Toggle
-  data.toggle = src.peek() > 0;
-  src.advance();
-  if (src.peek_mark(RC6_UNIT * 2) || src.peek_space(RC6_UNIT * 2)) {
-    src.advance();
+  const bool toggle = levels.get(8);
+  if (levels.get(9) != toggle || levels.get(10) == toggle || levels.get(11) == toggle) {
+    return {};
   }
+  data.toggle = toggle;
 
   // Data
-  offset = 0;
-  while (offset < 16) {
-    bit = src.peek() > 0;
-    buffer = buffer + (bit << (15 - offset++));
-    src.advance();
-
-    if (offset == 16) {
-      break;
-    } else if (src.peek_mark(RC6_UNIT) || src.peek_space(RC6_UNIT)) {
-      src.advance();
-    } else if (!src.peek_mark(RC6_UNIT * 2) && !src.peek_space(RC6_UNIT * 2)) {
-      return {};
-    }
+  uint32_t buffer;
+  if (!levels.decode_bits(12, 16, buffer)) {
+    return {};
   }
 
   data.address = (0xFF00 & buffer) >> 8;
@@ -179,3 +94,5 @@ void RC6Protocol::dump(const RC6Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_RC6
@@ -12,16 +12,17 @@ struct RC6Data {
   uint8_t command;
 
   bool operator==(const RC6Data &rhs) const { return address == rhs.address && command == rhs.command; }
+  uint64_t index_key() const { return (address << 8) | command; }
 };
 
-class RC6Protocol : public RemoteProtocol<RC6Data> {
+class RC6Protocol : public StaticRemoteProtocol<RC6Data> {
  public:
-  void encode(RemoteTransmitData *dst, const RC6Data &data) override;
-  optional<RC6Data> decode(RemoteReceiveData src) override;
-  void dump(const RC6Data &data) override;
+  void encode(RemoteTransmitData *dst, const RC6Data &data);
+  optional<RC6Data> decode(RemoteReceiveData src);
+  void dump(const RC6Data &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(RC6)
+DECLARE_INDEXED_REMOTE_PROTOCOL(RC6)
 
 template<typename... Ts> class RC6Action : public RemoteTransmitterActionBase<Ts...> {
  public:
@@ -1,6 +1,10 @@
 #include "rc_switch_protocol.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
+#ifdef USE_REMOTE_BASE_RC_SWITCH
+
 namespace esphome {
 namespace remote_base {
 
@@ -131,6 +135,11 @@ bool RCSwitchBase::decode(RemoteReceiveData &src, uint64_t *out_data, uint8_t *o
   }
   return true;
 }
+bool RCSwitchBase::operator==(const RCSwitchBase &rhs) const {
+  return this->sync_high_ == rhs.sync_high_ && this->sync_low_ == rhs.sync_low_ &&
+         this->zero_high_ == rhs.zero_high_ && this->zero_low_ == rhs.zero_low_ &&
+         this->one_high_ == rhs.one_high_ && this->one_low_ == rhs.one_low_ && this->inverted_ == rhs.inverted_;
+}
 optional<RCSwitchData> RCSwitchBase::decode(RemoteReceiveData &src) const {
   RCSwitchData out;
   uint8_t out_nbits;
@@ -246,6 +255,74 @@ bool RCSwitchRawReceiver::matches(RemoteReceiveData src) {
 
   return decoded_nbits == this->nbits_ && (decoded_code & this->mask_) == (this->code_ & this->mask_);
 }
+void RCSwitchRawReceiver::changed_() {
+  if (this->index_ != nullptr)
+    this->index_->invalidate();
+}
+
+void RCSwitchRawReceiverIndex::add(RCSwitchRawReceiver *receiver) {
+  receiver->index_ = this;
+  this->receivers_.push_back(receiver);
+  this->invalidate();
+}
+
+void RCSwitchRawReceiverIndex::build_() {
+  this->protocols_.clear();
+  std::vector<uint16_t> bucket_of(this->receivers_.size());
+  for (size_t idx = 0; idx < this->receivers_.size(); idx++) {
+    const RCSwitchRawReceiver *receiver = this->receivers_[idx];
+    const auto protocol = std::find(this->protocols_.begin(), this->protocols_.end(), receiver->protocol_);
+    const uint8_t protocol_idx = protocol - this->protocols_.begin();
+    if (protocol == this->protocols_.end())
+      this->protocols_.push_back(receiver->protocol_);
+    size_t bucket = 0;
+    while (bucket < this->buckets_.size() &&
+           (this->buckets_[bucket].protocol != protocol_idx || this->buckets_[bucket].nbits != receiver->nbits_ ||
+            this->buckets_[bucket].mask != receiver->mask_))
+      bucket++;
+    if (bucket == this->buckets_.size())
+      this->buckets_.push_back({protocol_idx, receiver->nbits_, receiver->mask_, 0, {}});
+    this->buckets_[bucket].count++;
+    bucket_of[idx] = bucket;
+  }
+  for (auto &bucket : this->buckets_)
+    bucket.table.reset(bucket.count);
+  for (size_t idx = 0; idx < this->receivers_.size(); idx++) {
+    auto &bucket = this->buckets_[bucket_of[idx]];
+    bucket.table.insert(this->receivers_[idx]->code_ & bucket.mask, idx);
+  }
+  ESP_LOGV(TAG, "Indexed %u receivers in %u buckets", (unsigned) this->receivers_.size(),
+           (unsigned) this->buckets_.size());
+}
+
+bool RCSwitchRawReceiverIndex::on_receive_(RemoteReceiveData src) {
+  if (this->buckets_.empty())
+    this->build_();
+  const bool probe = src.is_probe();
+  bool matched = false;
+  for (size_t protocol_idx = 0; protocol_idx < this->protocols_.size(); protocol_idx++) {
+    src.reset();
+    uint64_t code;
+    uint8_t nbits;
+    if (!this->protocols_[protocol_idx].decode(src, &code, &nbits))
+      continue;
+    for (const auto &bucket : this->buckets_) {
+      if (bucket.protocol != protocol_idx || bucket.nbits != nbits)
+        continue;
+      const uint64_t masked = code & bucket.mask;
+      bucket.table.find(masked, [this, &bucket, masked, probe, &matched](uint16_t idx) {
+        RCSwitchRawReceiver *receiver = this->receivers_[idx];
+        if ((receiver->code_ & bucket.mask) != masked)
+          return;
+        if (!probe)
+          receiver->publish_pulse_();
+        matched = true;
+      });
+    }
+  }
+  return matched;
+}
+
 bool RCSwitchDumper::dump(RemoteReceiveData src) {
   for (uint8_t i = 1; i <= 8; i++) {
     src.reset();
@@ -267,5 +344,11 @@ bool RCSwitchDumper::dump(RemoteReceiveData src) {
   return false;
 }
 
+void RemoteReceiverBase::register_listener(RCSwitchRawReceiver *receiver) {
+  this->get_listener_group_<RCSwitchRawReceiverIndex>()->add(receiver);
+}
+
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_RC_SWITCH
@@ -37,6 +37,8 @@ class RCSwitchBase {
 
   bool decode(RemoteReceiveData &src, uint64_t *out_data, uint8_t *out_nbits) const;
 
+  bool operator==(const RCSwitchBase &rhs) const;
+
   optional<RCSwitchData> decode(RemoteReceiveData &src) const;
 
   static void simple_code_to_tristate(uint16_t code, uint8_t nbits, uint64_t *out_code);
@@ -174,40 +176,91 @@ template<typename... Ts> class RCSwitchTypeDAction : public RemoteTransmitterAct
   }
 };
 
+class RCSwitchRawReceiverIndex;
+
 class RCSwitchRawReceiver : public RemoteReceiverBinarySensorBase {
  public:
-  void set_protocol(const RCSwitchBase &a_protocol) { this->protocol_ = a_protocol; }
-  void set_code(uint64_t code) { this->code_ = code; }
+  void set_protocol(const RCSwitchBase &a_protocol) {
+    this->protocol_ = a_protocol;
+    this->changed_();
+  }
+  void set_code(uint64_t code) {
+    this->code_ = code;
+    this->changed_();
+  }
   void set_code(const std::string &code) {
     this->code_ = decode_binary_string(code);
     this->mask_ = decode_binary_string_mask(code);
     this->nbits_ = code.size();
+    this->changed_();
+  }
+  void set_nbits(uint8_t nbits) {
+    this->nbits_ = nbits;
+    this->changed_();
   }
-  void set_nbits(uint8_t nbits) { this->nbits_ = nbits; }
   void set_type_a(const std::string &group, const std::string &device, bool state) {
     uint8_t u_group = decode_binary_string(group);
     uint8_t u_device = decode_binary_string(device);
     RCSwitchBase::type_a_code(u_group, u_device, state, &this->code_, &this->nbits_);
+    this->changed_();
   }
   void set_type_b(uint8_t address_code, uint8_t channel_code, bool state) {
     RCSwitchBase::type_b_code(address_code, channel_code, state, &this->code_, &this->nbits_);
+    this->changed_();
   }
   void set_type_c(std::string family, uint8_t group, uint8_t device, bool state) {
     auto u_family = static_cast<uint8_t>(tolower(family[0]) - 'a');
     RCSwitchBase::type_c_code(u_family, group, device, state, &this->code_, &this->nbits_);
+    this->changed_();
   }
   void set_type_d(std::string group, uint8_t device, bool state) {
     auto u_group = static_cast<uint8_t>(tolower(group[0]) - 'a');
     RCSwitchBase::type_d_code(u_group, device, state, &this->code_, &this->nbits_);
+    this->changed_();
   }
 
  protected:
+  friend class RCSwitchRawReceiverIndex;
+
   bool matches(RemoteReceiveData src) override;
+  /// Let the index this receiver is registered in pick up the new settings.
+  void changed_();
 
   RCSwitchBase protocol_;
   uint64_t code_;
   uint64_t mask_{0xFFFFFFFFFFFFFFFF};
   uint8_t nbits_;
+  RCSwitchRawReceiverIndex *index_{nullptr};
+};
+
+/// The RC Switch raw receivers of one receiver, called as a single listener. A frame is decoded once per distinct
+/// protocol, and receivers are grouped into buckets of equal protocol, code length and mask. Each bucket is a
+/// KeyTable keyed by the masked code, so a decoded code costs one lookup per bucket whatever the number of receivers.
+class RCSwitchRawReceiverIndex {
+ public:
+  static bool dispatch(void *context, RemoteReceiveData src) {
+    return static_cast<RCSwitchRawReceiverIndex *>(context)->on_receive_(src);
+  }
+  void add(RCSwitchRawReceiver *receiver);
+  void invalidate() { this->buckets_.clear(); }
+
+ protected:
+  struct Bucket {
+    uint8_t protocol;
+    uint8_t nbits;
+    uint64_t mask;
+    uint16_t count;
+    KeyTable table;
+  };
+
+  bool on_receive_(RemoteReceiveData src);
+  /// Bucket receivers by their current settings, done on the first frame after a change.
+  void build_();
+
+  std::vector<RCSwitchRawReceiver *> receivers_;
+  /// Distinct protocols of the receivers, Bucket::protocol indexes into it
+  std::vector<RCSwitchBase> protocols_;
+  std::vector<Bucket> buckets_;
 };
 
 class RCSwitchDumper : public RemoteReceiverDumperBase {
@@ -1,13 +1,21 @@
 #include "remote_base.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstdlib>
 
 namespace esphome {
 namespace remote_base {
 
 static const char *const TAG = "remote_base";
 
+// Frames shorter than this are noise to every protocol (RC5, the shortest, needs 14) and are not probed
+static const uint32_t MIN_PROBE_TIMINGS = 14;
+// Near misses of one protocol, each within this long of the previous one, before it is loosened
+static const uint8_t NEAR_MISS_COUNT = 3;
+static const uint32_t NEAR_MISS_WINDOW_MS = 1000;
+
 #ifdef USE_ESP32
 RemoteRMTChannel::RemoteRMTChannel(uint8_t mem_block_num) : mem_block_num_(mem_block_num) {
   static rmt_channel_t next_rmt_channel = RMT_CHANNEL_0;
@@ -37,7 +45,10 @@ bool RemoteReceiveData::peek_mark(uint32_t length, uint32_t offset) const {
   const int32_t value = this->peek(offset);
   const int32_t lo = this->lower_bound_(length);
   const int32_t hi = this->upper_bound_(length);
-  return value >= 0 && lo <= value && value <= hi;
+  if (value < 0 || value < lo || hi < value)
+    return false;
+  this->note_deviation(value, length);
+  return true;
 }
 
 bool RemoteReceiveData::peek_space(uint32_t length, uint32_t offset) const {
@@ -46,7 +57,10 @@ bool RemoteReceiveData::peek_space(uint32_t length, uint32_t offset) const {
   const int32_t value = this->peek(offset);
   const int32_t lo = this->lower_bound_(length);
   const int32_t hi = this->upper_bound_(length);
-  return value <= 0 && lo <= -value && -value <= hi;
+  if (value > 0 || -value < lo || hi < -value)
+    return false;
+  this->note_deviation(value, length);
+  return true;
 }
 
 bool RemoteReceiveData::peek_space_at_least(uint32_t length, uint32_t offset) const {
@@ -57,6 +71,41 @@ bool RemoteReceiveData::peek_space_at_least(uint32_t length, uint32_t offset) co
   return value <= 0 && lo <= -value;
 }
 
+void RemoteReceiveData::note_deviation(int32_t value, uint32_t length) const {
+  if (this->deviation_ == nullptr || length == 0)
+    return;
+  uint32_t deviation = std::abs(std::abs(value) - int32_t(length));
+  if (this->tolerance_mode_ == TOLERANCE_MODE_PERCENTAGE)
+    deviation = (deviation * 100 + length - 1) / length;
+  *this->deviation_ = std::max(*this->deviation_, deviation);
+}
+
+static const uint32_t FNV_OFFSET_BASIS = 2166136261UL;
+static const uint32_t FNV_PRIME = 16777619UL;
+
+static inline uint32_t fnv1a(uint32_t hash, uint32_t value) { return (hash ^ value) * FNV_PRIME; }
+
+uint32_t timing_pattern_hash(const RawTimings &data) {
+  const size_t size = data.size();
+  uint32_t hash = fnv1a(FNV_OFFSET_BASIS, size);
+  for (size_t idx = 2; idx < size; idx++) {
+    const uint32_t cur = std::abs(data[idx]);
+    const uint32_t prev = std::abs(data[idx - 2]);
+    // Classes meet at a ratio of 1.4, about halfway between equal and double on a log scale, so either survives
+    // jitter of up to 15% on each of the two durations
+    hash = fnv1a(hash, cur * 7 < prev * 5 ? 0 : (cur * 5 > prev * 7 ? 2 : 1));
+  }
+  return hash;
+}
+
+uint32_t RemoteReceiveData::get_pattern_hash() const {
+  if (this->pattern_hash_ == nullptr)
+    return timing_pattern_hash(this->data_);
+  if (!this->pattern_hash_->has_value())
+    *this->pattern_hash_ = timing_pattern_hash(this->data_);
+  return this->pattern_hash_->value();
+}
+
 bool RemoteReceiveData::expect_mark(uint32_t length) {
   if (!this->peek_mark(length))
     return false;
@@ -85,15 +134,148 @@ bool RemoteReceiveData::expect_pulse_with_gap(uint32_t mark, uint32_t space) {
   return true;
 }
 
+optional<uint64_t> RemoteReceiveData::read_bits(uint8_t nbits, BitOrder order, const BitTiming &timing) {
+  if (nbits == 0 || nbits > 64 || !this->is_valid(2 * nbits - 1))
+    return {};
+  // Bounds are worked out once, lower bounds clamped at 0 also reject an edge of the wrong polarity
+  const int32_t one_mark_lo = std::max<int32_t>(this->lower_bound_(timing.one_mark), 0);
+  const int32_t one_mark_hi = this->upper_bound_(timing.one_mark);
+  const int32_t one_space_lo = std::max<int32_t>(this->lower_bound_(timing.one_space), 0);
+  const int32_t one_space_hi = this->upper_bound_(timing.one_space);
+  const int32_t zero_mark_lo = std::max<int32_t>(this->lower_bound_(timing.zero_mark), 0);
+  const int32_t zero_mark_hi = this->upper_bound_(timing.zero_mark);
+  const int32_t zero_space_lo = std::max<int32_t>(this->lower_bound_(timing.zero_space), 0);
+  const int32_t zero_space_hi = this->upper_bound_(timing.zero_space);
+  const int32_t *data = this->data_.data() + this->index_;
+  uint64_t value = 0;
+  for (uint8_t bit = 0; bit < nbits; bit++) {
+    const int32_t mark = data[2 * bit];
+    const int32_t space = -data[2 * bit + 1];
+    const bool one = one_mark_lo <= mark && mark <= one_mark_hi && one_space_lo <= space && space <= one_space_hi;
+    const bool zero =
+        zero_mark_lo <= mark && mark <= zero_mark_hi && zero_space_lo <= space && space <= zero_space_hi;
+    if (!one && !zero)
+      return {};
+    value |= uint64_t(one) << bit;
+  }
+  if (this->is_tracking_deviation()) {
+    for (uint8_t bit = 0; bit < nbits; bit++) {
+      const bool one = (value >> bit) & 1;
+      this->note_deviation(data[2 * bit], one ? timing.one_mark : timing.zero_mark);
+      this->note_deviation(data[2 * bit + 1], one ? timing.one_space : timing.zero_space);
+    }
+  }
+  this->advance(2 * nbits);
+  return order == BIT_ORDER_MSB_FIRST ? reverse_bits_64(value) >> (64 - nbits) : value;
+}
+
+optional<SoftBits> RemoteReceiveData::read_soft_bits(uint8_t nbits, BitOrder order, const BitTiming &timing) {
+  if (nbits == 0 || nbits > 64 || !this->is_valid(2 * nbits - 1))
+    return {};
+  const int32_t one_mark_lo = std::max<int32_t>(this->lower_bound_(timing.one_mark), 0);
+  const int32_t one_mark_hi = this->upper_bound_(timing.one_mark);
+  const int32_t one_space_lo = std::max<int32_t>(this->lower_bound_(timing.one_space), 0);
+  const int32_t one_space_hi = this->upper_bound_(timing.one_space);
+  const int32_t zero_mark_lo = std::max<int32_t>(this->lower_bound_(timing.zero_mark), 0);
+  const int32_t zero_mark_hi = this->upper_bound_(timing.zero_mark);
+  const int32_t zero_space_lo = std::max<int32_t>(this->lower_bound_(timing.zero_space), 0);
+  const int32_t zero_space_hi = this->upper_bound_(timing.zero_space);
+  const int32_t *data = this->data_.data() + this->index_;
+  SoftBits bits{0, 0, nbits};
+  for (uint8_t bit = 0; bit < nbits; bit++) {
+    const int32_t mark = data[2 * bit];
+    const int32_t space = -data[2 * bit + 1];
+    const bool one_mark = one_mark_lo <= mark && mark <= one_mark_hi;
+    const bool one_space = one_space_lo <= space && space <= one_space_hi;
+    const bool zero_mark = zero_mark_lo <= mark && mark <= zero_mark_hi;
+    const bool zero_space = zero_space_lo <= space && space <= zero_space_hi;
+    if (one_mark && one_space) {
+      bits.value |= uint64_t(1) << bit;
+    } else if (!(zero_mark && zero_space)) {
+      // Still a mark and a space, so the items after it keep their place
+      if (mark <= 0 || space <= 0 || !(one_mark || zero_mark || one_space || zero_space))
+        return {};
+      bits.erasures |= uint64_t(1) << bit;
+    }
+  }
+  if (this->is_tracking_deviation()) {
+    for (uint8_t bit = 0; bit < nbits; bit++) {
+      if ((bits.erasures >> bit) & 1)
+        continue;
+      const bool one = (bits.value >> bit) & 1;
+      this->note_deviation(data[2 * bit], one ? timing.one_mark : timing.zero_mark);
+      this->note_deviation(data[2 * bit + 1], one ? timing.one_space : timing.zero_space);
+    }
+  }
+  this->advance(2 * nbits);
+  if (order == BIT_ORDER_MSB_FIRST) {
+    bits.value = reverse_bits_64(bits.value) >> (64 - nbits);
+    bits.erasures = reverse_bits_64(bits.erasures) >> (64 - nbits);
+  }
+  return bits;
+}
+
+/* RemoteTransmitData */
+
+void RemoteTransmitData::append_bits(uint64_t value, uint8_t nbits, BitOrder order, const BitTiming &timing) {
+  nbits = std::min<uint8_t>(nbits, 64);
+  if (nbits == 0)
+    return;
+  const size_t start = this->data_.size();
+  // One resize for the whole run, InlineBuffer clamps it to what still fits
+  this->data_.resize(start + 2 * nbits);
+  const size_t count = this->data_.size() - start;
+  int32_t *out = this->data_.data() + start;
+  // Lengths are selected with a mask, a branch per bit mispredicts on every other bit of a random payload
+  const int32_t zero_mark = timing.zero_mark;
+  const int32_t zero_space = -int32_t(timing.zero_space);
+  const int32_t diff_mark = zero_mark ^ int32_t(timing.one_mark);
+  const int32_t diff_space = zero_space ^ -int32_t(timing.one_space);
+  // Bits are taken from the low end, most significant first is turned into that by reversing them
+  if (order == BIT_ORDER_MSB_FIRST)
+    value = reverse_bits_64(value) >> (64 - nbits);
+  for (size_t i = 0; i + 1 < count; i += 2, value >>= 1) {
+    const int32_t one = -int32_t(value & 1);
+    out[i] = zero_mark ^ (diff_mark & one);
+    out[i + 1] = zero_space ^ (diff_space & one);
+  }
+  // Truncated by the capacity, keep the mark of the last bit that fits
+  if (count % 2 != 0)
+    out[count - 1] = zero_mark ^ (diff_mark & -int32_t(value & 1));
+}
+
 /* RemoteReceiverBinarySensorBase */
 
 bool RemoteReceiverBinarySensorBase::on_receive(RemoteReceiveData src) {
   if (!this->matches(src))
     return false;
+  if (!src.is_probe())
+    this->publish_pulse_();
+  return true;
+}
+
+void RemoteReceiverBinarySensorBase::publish_pulse_() {
   this->publish_state(true);
   yield();
   this->publish_state(false);
-  return true;
+}
+
+/* KeyTable */
+
+void KeyTable::reset(size_t count) {
+  uint8_t bits = 2;
+  while ((size_t(1) << bits) < count * 2)
+    bits++;
+  this->shift_ = 64 - bits;
+  this->slots_.assign(size_t(1) << bits, 0);
+}
+
+void KeyTable::insert(uint64_t key, uint16_t value) {
+  const size_t mask = this->slots_.size() - 1;
+  size_t slot = this->slot_of_(key);
+  while (this->slots_[slot] != 0)
+    slot = (slot + 1) & mask;
+  this->slots_[slot] = value + 1;
 }
 
 /* RemoteReceiverBase */
@@ -106,23 +288,253 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   }
 }
 
-void RemoteReceiverBase::call_listeners_() {
-  for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+RemoteReceiveData RemoteReceiverBase::make_data_(uint32_t tolerance, bool repeat) {
+  RemoteReceiveData data(this->temp_, tolerance, this->tolerance_mode_);
+  data.set_repeat(repeat);
+  data.set_error_correction(this->error_correction_);
+  data.set_pattern_hash_cache(&this->pattern_hash_);
+  return data;
+}
+
+static bool in_mask(uint32_t mask, size_t idx) { return idx >= 32 || (mask >> idx) & 1; }
+
+uint32_t RemoteReceiverBase::call_listeners_(uint32_t mask, bool repeat) {
+  if (!this->is_adaptive_()) {
+    uint32_t accepted = 0;
+    for (size_t idx = 0; idx < this->listeners_.size(); idx++) {
+      if (!in_mask(mask, idx))
+        continue;
+      const auto &listener = this->listeners_[idx];
+      REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_LISTENER, listener.context, idx);
+      RemoteReceiveData data = this->make_data_(this->tolerance_, repeat);
+      if (listener.on_receive(listener.context, data) && idx < 32)
+        accepted |= 1UL << idx;
+    }
+    return accepted;
+  }
+
+  this->assign_adaptive_slots_();
+  bool any = false;
+  uint32_t accepted = 0;
+  for (size_t idx = 0; idx < this->listeners_.size(); idx++) {
+    if (!in_mask(mask, idx))
+      continue;
+    auto &slot = this->adaptive_[this->adaptive_slots_[idx]];
+    const auto &listener = this->listeners_[idx];
+    REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_LISTENER, listener.context, idx);
+    uint32_t deviation = 0;
+    RemoteReceiveData data = this->make_data_(slot.tolerance, repeat);
+    data.set_deviation_tracker(&deviation);
+    if (!listener.on_receive(listener.context, data))
+      continue;
+    this->adapt_tolerance_(slot, deviation);
+    any = true;
+    if (idx < 32)
+      accepted |= 1UL << idx;
+  }
+  if (!any && !repeat && this->temp_.size() >= MIN_PROBE_TIMINGS)
+    this->probe_near_misses_(mask);
+  return accepted;
+}
+
+void RemoteReceiverBase::probe_near_misses_(uint32_t mask) {
+  const uint32_t now = millis();
+  this->probe_seq_++;
+  for (size_t idx = 0; idx < this->listeners_.size(); idx++) {
+    if (!in_mask(mask, idx))
+      continue;
+    auto &slot = this->adaptive_[this->adaptive_slots_[idx]];
+    if (!slot.probing || slot.tolerance >= this->adaptive_max_ || slot.probe_seq == this->probe_seq_)
+      continue;
+    const auto &listener = this->listeners_[idx];
+    REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_LISTENER, listener.context, idx);
+    uint32_t deviation = 0;
+    RemoteReceiveData data = this->make_data_(this->adaptive_max_, false);
+    data.set_deviation_tracker(&deviation);
+    data.set_probe(true);
+    if (!listener.on_receive(listener.context, data))
+      continue;
+    slot.probe_seq = this->probe_seq_;
+    if (now - slot.last_near_miss > NEAR_MISS_WINDOW_MS) {
+      slot.near_misses = 0;
+      slot.near_miss_deviation = 0;
+    }
+    slot.near_misses++;
+    slot.last_near_miss = now;
+    slot.near_miss_deviation = std::max(slot.near_miss_deviation, deviation);
+    ESP_LOGV(TAG, "Near miss %u at deviation %" PRIu32, slot.near_misses, deviation);
+    if (slot.near_misses < NEAR_MISS_COUNT)
+      continue;
+    // A run of frames the protocol only decodes at the upper limit, give it what they needed. The average is set to
+    // match, so the next frames decoded in the first pass tighten it again from there.
+    const uint32_t target = std::clamp(slot.near_miss_deviation + slot.near_miss_deviation / 4 + 1,
+                                       this->adaptive_min_, this->adaptive_max_);
+    ESP_LOGV(TAG, "Tolerance %" PRIu32 " -> %" PRIu32 " after %u near misses", slot.tolerance, target,
+             slot.near_misses);
+    slot.tolerance = std::max(slot.tolerance, target);
+    slot.average = slot.tolerance * 32 / 3;
+    slot.near_misses = 0;
+  }
+}
+
+uint32_t RemoteReceiverBase::get_listener_tolerance(size_t index) {
+  if (!this->is_adaptive_() || index >= this->listeners_.size())
+    return this->tolerance_;
+  this->assign_adaptive_slots_();
+  return this->adaptive_[this->adaptive_slots_[index]].tolerance;
+}
+
+void RemoteReceiverBase::assign_adaptive_slots_() {
+  if (this->adaptive_slots_.size() == this->listeners_.size())
+    return;
+  // Listeners of the same protocol share their callback, generic listeners all use the same thunk and get a slot each
+  const auto generic = make_listener_entry(static_cast<RemoteReceiverListener *>(nullptr)).on_receive;
+  const uint32_t initial = std::clamp(this->tolerance_, this->adaptive_min_, this->adaptive_max_);
+  for (size_t idx = this->adaptive_slots_.size(); idx < this->listeners_.size(); idx++) {
+    const auto on_receive = this->listeners_[idx].on_receive;
+    size_t slot = 0;
+    while (slot < this->adaptive_.size() && (on_receive == generic || this->adaptive_[slot].on_receive != on_receive))
+      slot++;
+    if (slot == this->adaptive_.size())
+      this->adaptive_.push_back({on_receive, initial, initial * 32 / 3, 0, 0, 0, 0, on_receive != generic});
+    this->adaptive_slots_.push_back(slot);
+  }
+}
+
+void RemoteReceiverBase::adapt_tolerance_(AdaptiveTolerance &slot, uint32_t deviation) {
+  slot.average = slot.average - slot.average / 8 + deviation * 2;
+  // Keep half the typical deviation as headroom
+  const uint32_t target = std::clamp(slot.average * 3 / 32, this->adaptive_min_, this->adaptive_max_);
+  if (target != slot.tolerance) {
+    ESP_LOGV(TAG, "Tolerance %" PRIu32 " -> %" PRIu32 " (deviation %" PRIu32 ")", slot.tolerance, target, deviation);
+    slot.tolerance = target;
+  }
+  // Decoding at its own tolerance ends a run of near misses
+  slot.near_misses = 0;
+}
+
+uint32_t RemoteReceiverBase::call_dumpers_(uint32_t mask, bool repeat) {
+  uint32_t success = 0;
+  for (size_t idx = 0; idx < this->dumpers_.size(); idx++) {
+    if (!in_mask(mask, idx))
+      continue;
+    REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_DUMPER, this->dumpers_[idx], idx);
+    RemoteReceiveData data = this->make_data_(this->tolerance_, repeat);
+    if (this->dumpers_[idx]->dump(data))
+      success |= idx < 32 ? 1UL << idx : 0;
+  }
+  if (success == 0) {
+    for (auto *dumper : this->secondary_dumpers_) {
+      REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_DUMPER, dumper, 0);
+      RemoteReceiveData data = this->make_data_(this->tolerance_, repeat);
+      dumper->dump(data);
+    }
+  }
+  return success;
+}
+
+bool RemoteReceiverBase::call_listeners_dumpers_() {
+  REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_RECEIVER, this, 0);
+  this->pattern_hash_.reset();
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+  // A full buffer after timings were dropped means this frame was cut off, listeners and dumpers only see its start
+  if (!this->truncation_logged_ && this->temp_.size() == RawTimings::capacity() && inline_buffer_overflows() > 0) {
+    ESP_LOGW(TAG, "Frame cut off at %u timings, raise inline_timings to receive it whole",
+             (unsigned) this->temp_.size());
+    this->truncation_logged_ = true;
+  }
+#endif
+  if (this->glitch_filter_ > 0) {
+    this->filter_glitches_();
+    if (this->temp_.empty())
+      return false;
+  }
+
+  if (this->repeat_cache_timeout_ == 0) {
+    const uint32_t listeners = this->call_listeners_();
+    return (this->call_dumpers_() | listeners) != 0;
+  }
+
+  const uint32_t fingerprint = this->fingerprint_();
+  const uint32_t now = millis();
+  RepeatCacheEntry *oldest = &this->repeat_cache_[0];
+  for (auto &entry : this->repeat_cache_) {
+    if (entry.valid && now - entry.last_seen > this->repeat_cache_timeout_)
+      entry.valid = false;
+    if (entry.valid && entry.fingerprint == fingerprint) {
+      ESP_LOGVV(TAG, "Repeated frame 0x%08" PRIX32, fingerprint);
+      const uint32_t listeners = this->call_listeners_(entry.listeners, true);
+      if (listeners != 0) {
+        const uint32_t dumpers = this->call_dumpers_(entry.dumpers, true);
+        entry.last_seen = now;
+        return (listeners | dumpers) != 0;
+      }
+      // None of the listeners that took the first copy take this one, forget the entry and offer the frame to the
+      // listeners that were skipped (listeners past the 32nd are asked again)
+      entry.valid = false;
+      return this->dispatch_uncached_(entry, fingerprint, now, ~entry.listeners);
+    }
+    if (oldest->valid && (!entry.valid || now - entry.last_seen > now - oldest->last_seen))
+      oldest = &entry;
+  }
+  return this->dispatch_uncached_(*oldest, fingerprint, now, UINT32_MAX);
+}
+
+bool RemoteReceiverBase::dispatch_uncached_(RepeatCacheEntry &entry, uint32_t fingerprint, uint32_t now,
+                                            uint32_t mask) {
+  const uint32_t listeners = this->call_listeners_(mask);
+  const uint32_t dumpers = this->call_dumpers_();
+  // Only cache frames a listener took, a frame nobody decoded would otherwise keep its repeats from every listener
+  if (listeners != 0) {
+    entry.fingerprint = fingerprint;
+    entry.listeners = listeners;
+    entry.dumpers = dumpers;
+    entry.last_seen = now;
+    entry.valid = true;
+  }
+  return (listeners | dumpers) != 0;
 }
 
-void RemoteReceiverBase::call_dumpers_() {
-  bool success = false;
-  for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
-      success = true;
+void RemoteReceiverBase::filter_glitches_() {
+  auto &data = this->temp_;
+  const int32_t min_pulse = this->glitch_filter_;
+  const size_t size = data.size();
+  size_t out = 0;
+  for (size_t in = 0; in < size; in++) {
+    const int32_t value = data[in];
+    // A frame starts with a real mark, everything before it is noise
+    if (out == 0 && value < min_pulse)
+      continue;
+    if (std::abs(value) >= min_pulse) {
+      data[out++] = value;
+      continue;
+    }
+    // Glitch at the end of the frame
+    if (in + 1 == size)
+      break;
+    // Glitch inside a pulse (mark/space/mark or space/mark/space), join it and the following pulse to the previous
+    const int32_t prev = data[out - 1];
+    const int32_t joined = std::abs(prev) + std::abs(value) + std::abs(data[++in]);
+    data[out - 1] = prev < 0 ? -joined : joined;
   }
-  if (!success) {
-    for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+  if (out != size) {
+    ESP_LOGVV(TAG, "Glitch filter removed %u of %u timings", (unsigned) (size - out), (unsigned) size);
+    data.resize(out);
   }
 }
 
+uint32_t RemoteReceiverBase::fingerprint_() {
+  // The relative timing pattern followed by the total length with three significant bits, which tells apart
+  // protocols that share a pattern at different speeds
+  if (!this->pattern_hash_.has_value())
+    this->pattern_hash_ = timing_pattern_hash(this->temp_);
+  uint32_t total = 0;
+  for (const int32_t value : this->temp_)
+    total += std::abs(value);
+  const uint8_t shift = total < 8 ? 0 : 29 - __builtin_clz(total);
+  return fnv1a(this->pattern_hash_.value(), (total >> shift) << 5 | shift);
+}
+
 void RemoteReceiverBinarySensorBase::dump_config() { LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", this); }
 
 void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
@@ -162,6 +574,7 @@ void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
     ESP_LOGVV(TAG, "%s", buffer);
   }
 #endif
+  REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_TRANSMITTER, this, 0);
   this->send_internal(send_times, send_wait);
 }
 }  // namespace remote_base
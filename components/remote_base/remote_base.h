@@ -1,3 +1,4 @@
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -6,7 +7,10 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
+#include "alloc_tracking.h"
+#include "inline_buffer.h"
 
 #ifdef USE_ESP32
 #include <driver/rmt.h>
@@ -20,7 +24,55 @@ enum ToleranceMode : uint8_t {
   TOLERANCE_MODE_TIME = 1,
 };
 
+enum BitOrder : uint8_t {
+  BIT_ORDER_LSB_FIRST = 0,
+  BIT_ORDER_MSB_FIRST = 1,
+};
+
+/// Mirror the 64 bits of x, the first bit becomes the last.
+inline uint64_t reverse_bits_64(uint64_t x) {
+  x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+  x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+  x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+  x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+  return (x >> 32) | (x << 32);
+}
+
+/// Mark and space of a one and a zero bit. Pulse-distance codes share the mark, pulse-width codes the space.
+struct BitTiming {
+  uint32_t one_mark;
+  uint32_t one_space;
+  uint32_t zero_mark;
+  uint32_t zero_space;
+};
+
+/// Bits read with RemoteReceiveData::read_soft_bits(). Every bit whose timing was ambiguous has its erasures bit set
+/// and its value bit cleared.
+struct SoftBits {
+  uint64_t value;
+  uint64_t erasures;
+  uint8_t nbits;
+
+  /// Fill the erased bits from a redundant copy of the same bits, sent inverted if inverted is set. Fails if a bit is
+  /// erased in both copies or the copies disagree on a bit both of them hold.
+  optional<uint64_t> merge(const SoftBits &copy, bool inverted) const {
+    if (copy.nbits != this->nbits)
+      return {};
+    const uint64_t mask = this->nbits == 64 ? ~0ULL : (1ULL << this->nbits) - 1;
+    const uint64_t other = inverted ? ~(copy.value | copy.erasures) & mask : copy.value;
+    if ((this->erasures & copy.erasures) != 0 || ((this->value ^ other) & ~(this->erasures | copy.erasures)) != 0)
+      return {};
+    return this->value | (other & this->erasures);
+  }
+};
+
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+/// Frames live inside the receiver and transmit calls, the capacity covers the longest frame of the protocols in use.
+using RawTimings = InlineBuffer<int32_t, REMOTE_BASE_TIMINGS_CAPACITY>;
+#else
 using RawTimings = std::vector<int32_t>;
+#endif
 
 class RemoteTransmitData {
  public:
@@ -31,10 +83,16 @@ class RemoteTransmitData {
     this->space(space);
   }
   void reserve(uint32_t len) { this->data_.reserve(len); }
+  /// Append the lowest nbits (at most 64) of value as one mark/space item per bit. The buffer is grown once and
+  /// written without a capacity check per edge.
+  void append_bits(uint64_t value, uint8_t nbits, BitOrder order, const BitTiming &timing);
   void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
   uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
   const RawTimings &get_data() const { return this->data_; }
   void set_data(const RawTimings &data) { this->data_ = data; }
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+  void set_data(const std::vector<int32_t> &data) { this->data_.assign(data.begin(), data.end()); }
+#endif
   void reset() {
     this->data_.clear();
     this->carrier_frequency_ = 0;
@@ -45,6 +103,11 @@ class RemoteTransmitData {
   uint32_t carrier_frequency_{0};
 };
 
+/// FNV-1a hash of the size of a frame and, for each mark and space, whether it is shorter, about equal to or longer
+/// than the previous one of the same polarity. Receiver jitter stays inside these classes, so copies of one frame map
+/// to the same value.
+uint32_t timing_pattern_hash(const RawTimings &data);
+
 class RemoteReceiveData {
  public:
   explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
@@ -52,6 +115,16 @@ class RemoteReceiveData {
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
+  /// True if the receiver recognized this frame as a repeat of a recently received one.
+  bool is_repeat() const { return this->repeat_; }
+  void set_repeat(bool repeat) { this->repeat_ = repeat; }
+  /// True if decoders may repair ambiguous bits from the redundant copies some protocols send, see SoftBits.
+  bool is_error_correcting() const { return this->error_correction_; }
+  void set_error_correction(bool error_correction) { this->error_correction_ = error_correction; }
+  /// timing_pattern_hash() of the whole frame. Copies given the same cache share the result, so it is worked out
+  /// once per frame however many listeners ask for it.
+  uint32_t get_pattern_hash() const;
+  void set_pattern_hash_cache(optional<uint32_t> *cache) { this->pattern_hash_ = cache; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
   bool is_valid(uint32_t offset) const { return this->index_ + offset < this->data_.size(); }
@@ -67,6 +140,12 @@ class RemoteReceiveData {
   bool expect_space(uint32_t length);
   bool expect_item(uint32_t mark, uint32_t space);
   bool expect_pulse_with_gap(uint32_t mark, uint32_t space);
+  /// Read nbits (at most 64) mark/space items as bits, a one is tried before a zero. Either all of them are bits and
+  /// the index moves past them, or nothing is consumed.
+  optional<uint64_t> read_bits(uint8_t nbits, BitOrder order, const BitTiming &timing);
+  /// Same as read_bits(), but a bit with only one of its two edges outside the windows is returned as an erasure
+  /// instead of failing the read, for protocols that send their bits twice and can fill it in from the other copy.
+  optional<SoftBits> read_soft_bits(uint8_t nbits, BitOrder order, const BitTiming &timing);
   void advance(uint32_t amount = 1) { this->index_ += amount; }
   void reset() { this->index_ = 0; }
 
@@ -76,6 +155,17 @@ class RemoteReceiveData {
   }
   uint32_t get_tolerance() { return tolerance_; }
   ToleranceMode get_tolerance_mode() { return this->tolerance_mode_; }
+  /// Keep the largest deviation of a matched mark or space from its nominal length in *deviation, in tolerance
+  /// units. Copies of this object share the tracker.
+  void set_deviation_tracker(uint32_t *deviation) { this->deviation_ = deviation; }
+  /// True if the receiver only asks whether the frame decodes, the listener must not publish or trigger anything.
+  bool is_probe() const { return this->probe_; }
+  void set_probe(bool probe) { this->probe_ = probe; }
+  bool is_tracking_deviation() const { return this->deviation_ != nullptr; }
+  void note_deviation(int32_t value, uint32_t length) const;
+  /// Accepted range for a mark or space of the given nominal length, see peek_mark()/peek_space().
+  int32_t lower_bound(uint32_t length) const { return this->lower_bound_(length); }
+  int32_t upper_bound(uint32_t length) const { return this->upper_bound_(length); }
 
  protected:
   int32_t lower_bound_(uint32_t length) const {
@@ -99,6 +189,11 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  bool repeat_{false};
+  bool error_correction_{false};
+  bool probe_{false};
+  uint32_t *deviation_{nullptr};
+  optional<uint32_t> *pattern_hash_{nullptr};
 };
 
 class RemoteComponentBase {
@@ -173,41 +268,178 @@ class RemoteTransmitterBase : public RemoteComponentBase {
   RemoteTransmitData temp_;
 };
 
+/// Open addressing table of uint16_t values hashed by a 64-bit key, for listeners that look up the sensors of a
+/// decoded frame instead of asking each of them. Entries with equal keys, and keys that collide, sit next to each
+/// other up to the first free slot.
+class KeyTable {
+ public:
+  /// Drop all entries and size the table for count entries, at most half full.
+  void reset(size_t count);
+  void clear() { this->slots_.clear(); }
+  bool empty() const { return this->slots_.empty(); }
+  void insert(uint64_t key, uint16_t value);
+  /// Call f(value) for every entry that may have been inserted with key, the caller confirms the match.
+  template<typename F> void find(uint64_t key, F f) const {
+    if (this->slots_.empty())
+      return;
+    const size_t mask = this->slots_.size() - 1;
+    for (size_t slot = this->slot_of_(key); this->slots_[slot] != 0; slot = (slot + 1) & mask)
+      f(uint16_t(this->slots_[slot] - 1));
+  }
+
+ protected:
+  size_t slot_of_(uint64_t key) const {
+    // Fibonacci hashing, codes of one remote often differ in a few bits only
+    return (key * 0x9E3779B97F4A7C15ULL) >> this->shift_;
+  }
+
+  /// Value plus one, 0 marks a free slot
+  std::vector<uint16_t> slots_;
+  uint8_t shift_{63};
+};
+
 class RemoteReceiverListener {
  public:
   virtual bool on_receive(RemoteReceiveData data) = 0;
 };
 
+/// Entry of the receiver's listener table. Listeners whose type is known at registration get a direct callback,
+/// everything else goes through RemoteReceiverListener::on_receive().
+struct RemoteReceiverListenerEntry {
+  bool (*on_receive)(void *context, RemoteReceiveData data);
+  void *context;
+};
+
+inline RemoteReceiverListenerEntry make_listener_entry(RemoteReceiverListener *listener) {
+  return {[](void *context, RemoteReceiveData data) {
+            return static_cast<RemoteReceiverListener *>(context)->on_receive(data);
+          },
+          listener};
+}
+
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
 };
 
+template<typename T> class RemoteReceiverIndexedBinarySensor;
+template<typename T> class RemoteReceiverBinarySensorIndex;
+class RCSwitchRawReceiver;
+
 class RemoteReceiverBase : public RemoteComponentBase {
  public:
   RemoteReceiverBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
-  void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+  /// make_listener_entry() is looked up for the concrete listener type, so protocol triggers and binary sensors are
+  /// called without virtual dispatch.
+  template<typename L> void register_listener(L *listener) { this->listeners_.push_back(make_listener_entry(listener)); }
+  /// Indexed binary sensors of one protocol share a single listener, see RemoteReceiverBinarySensorIndex.
+  template<typename T> void register_listener(RemoteReceiverIndexedBinarySensor<T> *sensor) {
+    this->get_listener_group_<RemoteReceiverBinarySensorIndex<T>>()->add(sensor);
+  }
+  /// All RC Switch raw receivers share a single listener, see RCSwitchRawReceiverIndex.
+  void register_listener(RCSwitchRawReceiver *receiver);
   void register_dumper(RemoteReceiverDumperBase *dumper);
   void set_tolerance(uint32_t tolerance, ToleranceMode tolerance_mode) {
     this->tolerance_ = tolerance;
     this->tolerance_mode_ = tolerance_mode;
   }
+  /// Frames that repeat a frame seen less than timeout ms ago are only passed to the listeners and dumpers that
+  /// accepted the first copy. 0 disables the cache.
+  void set_repeat_cache_timeout(uint32_t timeout) { this->repeat_cache_timeout_ = timeout; }
+  /// Before dispatch, fold pulses shorter than min_pulse us into their neighbours and strip such noise from the
+  /// start and end of the frame. 0 disables the filter.
+  void set_glitch_filter(uint32_t min_pulse) { this->glitch_filter_ = min_pulse; }
+  /// Tune the tolerance of each protocol between min and max from the jitter of the frames it decodes. A frame no
+  /// listener accepts is probed at max without being published, a protocol that matches several such frames in a
+  /// row is loosened to what they needed.
+  void set_adaptive_tolerance(uint32_t min, uint32_t max) {
+    this->adaptive_min_ = min;
+    this->adaptive_max_ = max;
+  }
+  /// Let decoders of protocols with redundant copies (Midea, Coolix, Toshiba AC) repair a bit that does not decode
+  /// in one copy from the other copy, instead of dropping the frame.
+  void set_error_correction(bool error_correction) { this->error_correction_ = error_correction; }
+  /// Tolerance currently used for the listener registered at index.
+  uint32_t get_listener_tolerance(size_t index);
 
  protected:
-  void call_listeners_();
-  void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
+  /// Tolerance state shared by all listeners of one protocol
+  struct AdaptiveTolerance {
+    bool (*on_receive)(void *context, RemoteReceiveData data);
+    uint32_t tolerance;
+    /// Moving average of the per frame deviation, times 16
+    uint32_t average;
+    /// Largest deviation and millis() of the latest frame in the current run of near misses
+    uint32_t near_miss_deviation;
+    uint32_t last_near_miss;
+    /// probe_seq_ of the last probe pass that decoded with this slot, the frame is probed once per protocol
+    uint16_t probe_seq;
+    uint8_t near_misses;
+    /// False for generic listeners, they are not known to honour RemoteReceiveData::is_probe()
+    bool probing;
+  };
+  struct RepeatCacheEntry {
+    uint32_t fingerprint;
+    uint32_t last_seen;
+    uint32_t listeners;
+    uint32_t dumpers;
+    bool valid;
+  };
+
+  /// Call the listeners (dumpers) whose bit is set in mask, listeners past the 32nd are always called. Returns the
+  /// mask of those that accepted the frame.
+  uint32_t call_listeners_(uint32_t mask = UINT32_MAX, bool repeat = false);
+  uint32_t call_dumpers_(uint32_t mask = UINT32_MAX, bool repeat = false);
+  /// Returns true if one of the first 32 listeners or dumpers accepted the frame.
+  bool call_listeners_dumpers_();
+  /// Dispatch a frame that is not a cached repeat to the listeners in mask and all dumpers, and cache it in entry if
+  /// a listener accepted it.
+  bool dispatch_uncached_(RepeatCacheEntry &entry, uint32_t fingerprint, uint32_t now, uint32_t mask);
+  void filter_glitches_();
+  bool is_adaptive_() const { return this->adaptive_max_ > 0; }
+  void assign_adaptive_slots_();
+  void adapt_tolerance_(AdaptiveTolerance &slot, uint32_t deviation);
+  /// Probe the listeners in mask below the upper tolerance with a frame no one accepted, without publishing it.
+  void probe_near_misses_(uint32_t mask);
+  /// Receive data for one listener or dumper, with the receiver wide settings applied.
+  RemoteReceiveData make_data_(uint32_t tolerance, bool repeat);
+  /// The listener registered with G::dispatch, created on first use. Sensors of one kind register into it and share
+  /// the decoding of each frame.
+  template<typename G> G *get_listener_group_() {
+    for (auto &entry : this->listeners_) {
+      if (entry.on_receive == &G::dispatch)
+        return static_cast<G *>(entry.context);
+    }
+    auto *group = new G();  // NOLINT(cppcoreguidelines-owning-memory)
+    this->listeners_.push_back({&G::dispatch, group});
+    return group;
   }
+  /// Hash of the frame's relative timing pattern and its coarse total length, stable under jitter.
+  uint32_t fingerprint_();
 
-  std::vector<RemoteReceiverListener *> listeners_;
+  std::vector<RemoteReceiverListenerEntry> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t repeat_cache_timeout_{0};
+  uint32_t glitch_filter_{0};
+  bool error_correction_{false};
+  uint32_t adaptive_min_{0};
+  uint32_t adaptive_max_{0};
+  std::vector<AdaptiveTolerance> adaptive_;
+  /// Index into adaptive_ for each listener, generic listeners get a slot each so there may be more than 255
+  std::vector<uint16_t> adaptive_slots_;
+  uint16_t probe_seq_{0};
+  std::array<RepeatCacheEntry, 4> repeat_cache_{};
+  /// timing_pattern_hash() of temp_, cleared for every frame
+  optional<uint32_t> pattern_hash_{};
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+  /// A frame did not fit the inline buffer and was logged, later ones are only counted
+  bool truncation_logged_{false};
+#endif
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -218,6 +450,9 @@ class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitial
   void dump_config() override;
   virtual bool matches(RemoteReceiveData src) = 0;
   bool on_receive(RemoteReceiveData src) override;
+
+ protected:
+  void publish_pulse_();
 };
 
 /* TEMPLATES */
@@ -230,12 +465,40 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/// Static-dispatch variant of RemoteProtocol. Protocols implement encode()/decode()/dump() as plain member
+/// functions and the templates below call them on the concrete type, so no vtable is needed.
+template<typename T> class StaticRemoteProtocol {
+ public:
+  using ProtocolData = T;
+};
+
+/// Runtime-polymorphic RemoteProtocol<T> view of a static-dispatch protocol.
+template<typename P> class RemoteProtocolAdapter : public RemoteProtocol<typename P::ProtocolData> {
+ public:
+  using ProtocolData = typename P::ProtocolData;
+  void encode(RemoteTransmitData *dst, const ProtocolData &data) override { this->protocol_.encode(dst, data); }
+  optional<ProtocolData> decode(RemoteReceiveData src) override { return this->protocol_.decode(src); }
+  void dump(const ProtocolData &data) override { this->protocol_.dump(data); }
+
+ protected:
+  P protocol_;
+};
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
+  static bool dispatch(void *context, RemoteReceiveData src) {
+    auto *sensor = static_cast<RemoteReceiverBinarySensor *>(context);
+    if (!sensor->matches(src))
+      return false;
+    if (!src.is_probe())
+      sensor->publish_pulse_();
+    return true;
+  }
+
  protected:
-  bool matches(RemoteReceiveData src) override {
+  bool matches(RemoteReceiveData src) final {
     auto proto = T();
     auto res = proto.decode(src);
     return res.has_value() && *res == this->data_;
@@ -250,18 +513,96 @@ template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBin
 
 template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
+ public:
+  static bool dispatch(void *context, RemoteReceiveData src) {
+    return static_cast<RemoteReceiverTrigger *>(context)->on_receive(src);
+  }
+
  protected:
-  bool on_receive(RemoteReceiveData src) override {
+  bool on_receive(RemoteReceiveData src) final {
     auto proto = T();
     auto res = proto.decode(src);
     if (res.has_value()) {
-      this->trigger(*res);
+      if (!src.is_probe())
+        this->trigger(*res);
       return true;
     }
     return false;
   }
 };
 
+/// Binary sensor of a protocol whose data has an index_key(), a value shared by all data that operator== accepts as
+/// equal (for wildcards, the key leaves out the wildcard field). The receiver keeps these sensors in one
+/// RemoteReceiverBinarySensorIndex per protocol, so a frame is decoded once and only compared with the sensors
+/// registered for its key.
+template<typename T> class RemoteReceiverIndexedBinarySensor : public RemoteReceiverBinarySensor<T> {
+ public:
+  void set_data(typename T::ProtocolData data) {
+    this->data_ = data;
+    if (this->index_ != nullptr)
+      this->index_->invalidate();
+  }
+
+ protected:
+  friend class RemoteReceiverBinarySensorIndex<T>;
+
+  RemoteReceiverBinarySensorIndex<T> *index_{nullptr};
+};
+
+/// KeyTable from index_key() to the indexed binary sensors of one protocol on one receiver, called as a single
+/// listener. The table is built on the first frame, once codegen has set the data of every sensor.
+template<typename T> class RemoteReceiverBinarySensorIndex {
+ public:
+  using Sensor = RemoteReceiverIndexedBinarySensor<T>;
+
+  static bool dispatch(void *context, RemoteReceiveData src) {
+    return static_cast<RemoteReceiverBinarySensorIndex *>(context)->on_receive_(src);
+  }
+  void add(Sensor *sensor) {
+    sensor->index_ = this;
+    this->sensors_.push_back(sensor);
+    this->invalidate();
+  }
+  void invalidate() { this->table_.clear(); }
+
+ protected:
+  void build_() {
+    this->table_.reset(this->sensors_.size());
+    for (size_t idx = 0; idx < this->sensors_.size(); idx++)
+      this->table_.insert(this->sensors_[idx]->data_.index_key(), idx);
+  }
+  bool on_receive_(RemoteReceiveData src) {
+    auto res = T().decode(src);
+    if (!res.has_value())
+      return false;
+    if (this->table_.empty())
+      this->build_();
+    const bool probe = src.is_probe();
+    bool matched = false;
+    this->table_.find(res->index_key(), [this, &res, probe, &matched](uint16_t idx) {
+      Sensor *sensor = this->sensors_[idx];
+      if (*res == sensor->data_) {
+        if (!probe)
+          sensor->publish_pulse_();
+        matched = true;
+      }
+    });
+    return matched;
+  }
+
+  std::vector<Sensor *> sensors_;
+  /// Empty until the first frame after a change
+  KeyTable table_;
+};
+
+template<typename T> RemoteReceiverListenerEntry make_listener_entry(RemoteReceiverBinarySensor<T> *sensor) {
+  return {&RemoteReceiverBinarySensor<T>::dispatch, sensor};
+}
+
+template<typename T> RemoteReceiverListenerEntry make_listener_entry(RemoteReceiverTrigger<T> *trigger) {
+  return {&RemoteReceiverTrigger<T>::dispatch, trigger};
+}
+
 class RemoteTransmittable {
  public:
   RemoteTransmittable() {}
@@ -271,6 +612,7 @@ class RemoteTransmittable {
  protected:
   template<typename Protocol>
   void transmit_(const typename Protocol::ProtocolData &data, uint32_t send_times = 1, uint32_t send_wait = 0) {
+    REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_ACTION, this, 0);
     this->transmitter_->transmit<Protocol>(data, send_times, send_wait);
   }
   RemoteTransmitterBase *transmitter_;
@@ -282,6 +624,7 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 
  protected:
   void play(Ts... x) override {
+    REMOTE_BASE_ALLOC_SCOPE(ALLOC_OWNER_ACTION, this, 0);
     auto call = this->transmitter_->transmit();
     this->encode(call.get_data(), x...);
     call.set_send_times(this->send_times_.value_or(x..., 1));
@@ -308,6 +651,12 @@ template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBas
   using prefix##Trigger = RemoteReceiverTrigger<prefix##Protocol>; \
   using prefix##Dumper = RemoteReceiverDumper<prefix##Protocol>;
 #define DECLARE_REMOTE_PROTOCOL(prefix) DECLARE_REMOTE_PROTOCOL_(prefix)
+/// Same as DECLARE_REMOTE_PROTOCOL() for protocols whose data has an index_key(), binary sensors are indexed.
+#define DECLARE_INDEXED_REMOTE_PROTOCOL_(prefix) \
+  using prefix##BinarySensor = RemoteReceiverIndexedBinarySensor<prefix##Protocol>; \
+  using prefix##Trigger = RemoteReceiverTrigger<prefix##Protocol>; \
+  using prefix##Dumper = RemoteReceiverDumper<prefix##Protocol>;
+#define DECLARE_INDEXED_REMOTE_PROTOCOL(prefix) DECLARE_INDEXED_REMOTE_PROTOCOL_(prefix)
 
 }  // namespace remote_base
 }  // namespace esphome
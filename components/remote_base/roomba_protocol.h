@@ -11,11 +11,11 @@ struct RoombaData {
   bool operator==(const RoombaData &rhs) const { return data == rhs.data; }
 };
 
-class RoombaProtocol : public RemoteProtocol<RoombaData> {
+class RoombaProtocol : public StaticRemoteProtocol<RoombaData> {
  public:
-  void encode(RemoteTransmitData *dst, const RoombaData &data) override;
-  optional<RoombaData> decode(RemoteReceiveData src) override;
-  void dump(const RoombaData &data) override;
+  void encode(RemoteTransmitData *dst, const RoombaData &data);
+  optional<RoombaData> decode(RemoteReceiveData src);
+  void dump(const RoombaData &data);
 };
 
 DECLARE_REMOTE_PROTOCOL(Roomba)
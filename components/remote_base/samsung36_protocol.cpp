@@ -1,6 +1,8 @@
 #include "samsung36_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_SAMSUNG36
+
 namespace esphome {
 namespace remote_base {
 
@@ -13,6 +15,7 @@ static const uint32_t HEADER_LOW_US = 4500;
 static const uint32_t BIT_HIGH_US = 500;
 static const uint32_t BIT_ONE_LOW_US = 1500;
 static const uint32_t BIT_ZERO_LOW_US = 500;
+static const BitTiming BIT_TIMING{BIT_HIGH_US, BIT_ONE_LOW_US, BIT_HIGH_US, BIT_ZERO_LOW_US};
 static const uint32_t MIDDLE_HIGH_US = 500;
 static const uint32_t MIDDLE_LOW_US = 4500;
 static const uint32_t FOOTER_HIGH_US = 500;
@@ -26,25 +29,13 @@ void Samsung36Protocol::encode(RemoteTransmitData *dst, const Samsung36Data &dat
   dst->item(HEADER_HIGH_US, HEADER_LOW_US);
 
   // send first 16 bits
-  for (uint32_t mask = 1UL << 15; mask != 0; mask >>= 1) {
-    if (data.address & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  dst->append_bits(data.address, 16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
 
   // send middle header
   dst->item(MIDDLE_HIGH_US, MIDDLE_LOW_US);
 
   // send last 20 bits
-  for (uint32_t mask = 1UL << 19; mask != 0; mask >>= 1) {
-    if (data.command & mask) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  dst->append_bits(data.command, 20, BIT_ORDER_MSB_FIRST, BIT_TIMING);
 
   // footer
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
@@ -65,16 +56,10 @@ optional<Samsung36Data> Samsung36Protocol::decode(RemoteReceiveData src) {
     return {};
 
   // get the first 16 bits
-  for (uint8_t i = 0; i < 16; i++) {
-    out.address <<= 1UL;
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.address |= 1UL;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.address |= 0UL;
-    } else {
-      return {};
-    }
-  }
+  auto address = src.read_bits(16, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!address.has_value())
+    return {};
+  out.address = *address;
 
   // check if the middle mark matches
   if (!src.expect_item(MIDDLE_HIGH_US, MIDDLE_LOW_US)) {
@@ -82,16 +67,10 @@ optional<Samsung36Data> Samsung36Protocol::decode(RemoteReceiveData src) {
   }
 
   // get the last 20 bits
-  for (uint8_t i = 0; i < 20; i++) {
-    out.command <<= 1UL;
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.command |= 1UL;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.command |= 0UL;
-    } else {
-      return {};
-    }
-  }
+  auto command = src.read_bits(20, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!command.has_value())
+    return {};
+  out.command = *command;
 
   return out;
 }
@@ -101,3 +80,5 @@ void Samsung36Protocol::dump(const Samsung36Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_SAMSUNG36
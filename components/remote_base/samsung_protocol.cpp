@@ -1,7 +1,10 @@
 #include "samsung_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_SAMSUNG
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,19 +18,15 @@ static const uint32_t BIT_ZERO_LOW_US = 560;
 static const uint32_t FOOTER_HIGH_US = 560;
 static const uint32_t FOOTER_LOW_US = 560;
 
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_MSB_FIRST});
+
 void SamsungProtocol::encode(RemoteTransmitData *dst, const SamsungData &data) {
   dst->set_carrier_frequency(38000);
   dst->reserve(4 + data.nbits * 2u);
 
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-
-  for (uint8_t bit = data.nbits; bit > 0; bit--) {
-    if ((data.data >> (bit - 1)) & 1) {
-      dst->item(BIT_HIGH_US, BIT_ONE_LOW_US);
-    } else {
-      dst->item(BIT_HIGH_US, BIT_ZERO_LOW_US);
-    }
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_bits(dst, data.data, data.nbits);
 
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
 }
@@ -36,24 +35,11 @@ optional<SamsungData> SamsungProtocol::decode(RemoteReceiveData src) {
       .data = 0,
       .nbits = 0,
   };
-  if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
+  if (!CODEC.decode_header(src))
     return {};
 
-  for (out.nbits = 0; out.nbits < 64; out.nbits++) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.data = (out.data << 1) | 1;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.data = (out.data << 1) | 0;
-    } else if (out.nbits >= 31) {
-      if (!src.expect_mark(FOOTER_HIGH_US))
-        return {};
-      return out;
-    } else {
-      return {};
-    }
-  }
-
-  if (!src.expect_mark(FOOTER_HIGH_US))
+  out.nbits = CODEC.decode_bits_up_to(src, out.data, 64);
+  if (out.nbits < 31 || !src.expect_mark(FOOTER_HIGH_US))
     return {};
   return out;
 }
@@ -63,3 +49,5 @@ void SamsungProtocol::dump(const SamsungData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_SAMSUNG
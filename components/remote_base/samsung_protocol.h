@@ -11,16 +11,17 @@ struct SamsungData {
   uint8_t nbits;
 
   bool operator==(const SamsungData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
+  uint64_t index_key() const { return data ^ (uint64_t(nbits) << 56); }
 };
 
-class SamsungProtocol : public RemoteProtocol<SamsungData> {
+class SamsungProtocol : public StaticRemoteProtocol<SamsungData> {
  public:
-  void encode(RemoteTransmitData *dst, const SamsungData &data) override;
-  optional<SamsungData> decode(RemoteReceiveData src) override;
-  void dump(const SamsungData &data) override;
+  void encode(RemoteTransmitData *dst, const SamsungData &data);
+  optional<SamsungData> decode(RemoteReceiveData src);
+  void dump(const SamsungData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(Samsung)
+DECLARE_INDEXED_REMOTE_PROTOCOL(Samsung)
 
 template<typename... Ts> class SamsungAction : public RemoteTransmitterActionBase<Ts...> {
  public:
@@ -0,0 +1,65 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_BYTES,
+)
+from .. import remote_base_ns
+
+CONF_ALLOCATIONS = "allocations"
+CONF_ALLOCATED_BYTES = "allocated_bytes"
+CONF_RECEIVE_ALLOCATIONS = "receive_allocations"
+CONF_TRANSMIT_ALLOCATIONS = "transmit_allocations"
+
+AllocTrackingSensor = remote_base_ns.class_("AllocTrackingSensor", cg.PollingComponent)
+
+# Heap allocations counted by AllocTracker, the sensor turns alloc_tracking on by itself
+SENSOR_TYPES = {
+    CONF_ALLOCATIONS: sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    CONF_ALLOCATED_BYTES: sensor.sensor_schema(
+        unit_of_measurement=UNIT_BYTES,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    # Average per receive and transmit cycle
+    CONF_RECEIVE_ALLOCATIONS: sensor.sensor_schema(
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    CONF_TRANSMIT_ALLOCATIONS: sensor.sensor_schema(
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+}
+
+CONFIG_SCHEMA = (
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(AllocTrackingSensor),
+        }
+    )
+    .extend({cv.Optional(type): schema for type, schema in SENSOR_TYPES.items()})
+    .extend(cv.polling_component_schema("60s"))
+)
+
+
+async def to_code(config):
+    cg.add_define("USE_REMOTE_BASE_ALLOC_TRACKING")
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    for type_ in SENSOR_TYPES:
+        if conf := config.get(type_):
+            sens = await sensor.new_sensor(conf)
+            cg.add(getattr(var, f"set_{type_}_sensor")(sens))
@@ -0,0 +1,41 @@
+#include "alloc_tracking_sensor.h"
+
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+#include "esphome/core/log.h"
+
+#include <cmath>
+
+namespace esphome {
+namespace remote_base {
+
+static const char *const TAG = "remote_base.alloc_sensor";
+
+// Average allocations per cycle, NAN before the first cycle
+static float per_cycle(const AllocStats &cycle) {
+  return cycle.calls > 0 ? float(cycle.allocations) / cycle.calls : NAN;
+}
+
+void AllocTrackingSensor::update() {
+  if (this->allocations_sensor_ != nullptr)
+    this->allocations_sensor_->publish_state(AllocTracker::get_allocations());
+  if (this->allocated_bytes_sensor_ != nullptr)
+    this->allocated_bytes_sensor_->publish_state(AllocTracker::get_bytes());
+  if (this->receive_allocations_sensor_ != nullptr)
+    this->receive_allocations_sensor_->publish_state(per_cycle(AllocTracker::get_cycle_stats(false)));
+  if (this->transmit_allocations_sensor_ != nullptr)
+    this->transmit_allocations_sensor_->publish_state(per_cycle(AllocTracker::get_cycle_stats(true)));
+}
+
+void AllocTrackingSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Allocation Tracking:");
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Allocations", this->allocations_sensor_);
+  LOG_SENSOR("  ", "Allocated Bytes", this->allocated_bytes_sensor_);
+  LOG_SENSOR("  ", "Receive Allocations", this->receive_allocations_sensor_);
+  LOG_SENSOR("  ", "Transmit Allocations", this->transmit_allocations_sensor_);
+}
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_ALLOC_TRACKING
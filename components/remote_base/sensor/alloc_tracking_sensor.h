@@ -0,0 +1,33 @@
+#pragma once
+
+#include "esphome/components/remote_base/alloc_tracking.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace remote_base {
+
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+
+/// Publishes the AllocTracker totals and the average allocations per receive and transmit cycle.
+class AllocTrackingSensor : public PollingComponent {
+ public:
+  void update() override;
+  void dump_config() override;
+
+  void set_allocations_sensor(sensor::Sensor *sensor) { this->allocations_sensor_ = sensor; }
+  void set_allocated_bytes_sensor(sensor::Sensor *sensor) { this->allocated_bytes_sensor_ = sensor; }
+  void set_receive_allocations_sensor(sensor::Sensor *sensor) { this->receive_allocations_sensor_ = sensor; }
+  void set_transmit_allocations_sensor(sensor::Sensor *sensor) { this->transmit_allocations_sensor_ = sensor; }
+
+ protected:
+  sensor::Sensor *allocations_sensor_{nullptr};
+  sensor::Sensor *allocated_bytes_sensor_{nullptr};
+  sensor::Sensor *receive_allocations_sensor_{nullptr};
+  sensor::Sensor *transmit_allocations_sensor_{nullptr};
+};
+
+#endif  // USE_REMOTE_BASE_ALLOC_TRACKING
+
+}  // namespace remote_base
+}  // namespace esphome
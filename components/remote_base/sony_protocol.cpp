@@ -1,6 +1,8 @@
 #include "sony_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_SONY
+
 namespace esphome {
 namespace remote_base {
 
@@ -11,6 +13,7 @@ static const uint32_t HEADER_LOW_US = 600;
 static const uint32_t BIT_ONE_HIGH_US = 1200;
 static const uint32_t BIT_ZERO_HIGH_US = 600;
 static const uint32_t BIT_LOW_US = 600;
+static const BitTiming BIT_TIMING{BIT_ONE_HIGH_US, BIT_LOW_US, BIT_ZERO_HIGH_US, BIT_LOW_US};
 
 void SonyProtocol::encode(RemoteTransmitData *dst, const SonyData &data) {
   dst->set_carrier_frequency(40000);
@@ -18,13 +21,7 @@ void SonyProtocol::encode(RemoteTransmitData *dst, const SonyData &data) {
 
   dst->item(HEADER_HIGH_US, HEADER_LOW_US);
 
-  for (uint32_t mask = 1UL << (data.nbits - 1); mask != 0; mask >>= 1) {
-    if (data.data & mask) {
-      dst->item(BIT_ONE_HIGH_US, BIT_LOW_US);
-    } else {
-      dst->item(BIT_ZERO_HIGH_US, BIT_LOW_US);
-    }
-  }
+  dst->append_bits(data.data, data.nbits, BIT_ORDER_MSB_FIRST, BIT_TIMING);
 }
 optional<SonyData> SonyProtocol::decode(RemoteReceiveData src) {
   SonyData out{
@@ -67,3 +64,5 @@ void SonyProtocol::dump(const SonyData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_SONY
@@ -13,16 +13,17 @@ struct SonyData {
   uint8_t nbits;
 
   bool operator==(const SonyData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
+  uint64_t index_key() const { return (uint64_t(nbits) << 32) | data; }
 };
 
-class SonyProtocol : public RemoteProtocol<SonyData> {
+class SonyProtocol : public StaticRemoteProtocol<SonyData> {
  public:
-  void encode(RemoteTransmitData *dst, const SonyData &data) override;
-  optional<SonyData> decode(RemoteReceiveData src) override;
-  void dump(const SonyData &data) override;
+  void encode(RemoteTransmitData *dst, const SonyData &data);
+  optional<SonyData> decode(RemoteReceiveData src);
+  void dump(const SonyData &data);
 };
 
-DECLARE_REMOTE_PROTOCOL(Sony)
+DECLARE_INDEXED_REMOTE_PROTOCOL(Sony)
 
 template<typename... Ts> class SonyAction : public RemoteTransmitterActionBase<Ts...> {
  public:
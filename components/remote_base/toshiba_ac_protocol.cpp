@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_BASE_TOSHIBA_AC
+
 namespace esphome {
 namespace remote_base {
 
@@ -15,6 +17,7 @@ static const uint32_t BIT_ZERO_LOW_US = 560;
 static const uint32_t FOOTER_HIGH_US = 560;
 static const uint32_t FOOTER_LOW_US = 4500;
 static const uint16_t PACKET_SPACE = 5500;
+static const BitTiming BIT_TIMING{BIT_HIGH_US, BIT_ONE_LOW_US, BIT_HIGH_US, BIT_ZERO_LOW_US};
 
 void ToshibaAcProtocol::encode(RemoteTransmitData *dst, const ToshibaAcData &data) {
   dst->set_carrier_frequency(38000);
@@ -22,33 +25,18 @@ void ToshibaAcProtocol::encode(RemoteTransmitData *dst, const ToshibaAcData &dat
 
   for (uint8_t repeat = 0; repeat < 2; repeat++) {
     dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-    for (uint8_t bit = 48; bit > 0; bit--) {
-      dst->mark(BIT_HIGH_US);
-      if ((data.rc_code_1 >> (bit - 1)) & 1) {
-        dst->space(BIT_ONE_LOW_US);
-      } else {
-        dst->space(BIT_ZERO_LOW_US);
-      }
-    }
+    dst->append_bits(data.rc_code_1, 48, BIT_ORDER_MSB_FIRST, BIT_TIMING);
     dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
   }
 
   if (data.rc_code_2 != 0) {
     dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-    for (uint8_t bit = 48; bit > 0; bit--) {
-      dst->mark(BIT_HIGH_US);
-      if ((data.rc_code_2 >> (bit - 1)) & 1) {
-        dst->space(BIT_ONE_LOW_US);
-      } else {
-        dst->space(BIT_ZERO_LOW_US);
-      }
-    }
+    dst->append_bits(data.rc_code_2, 48, BIT_ORDER_MSB_FIRST, BIT_TIMING);
     dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
   }
 }
 
 optional<ToshibaAcData> ToshibaAcProtocol::decode(RemoteReceiveData src) {
-  uint64_t packet = 0;
   ToshibaAcData out{
       .rc_code_1 = 0,
       .rc_code_2 = 0,
@@ -56,33 +44,25 @@ optional<ToshibaAcData> ToshibaAcProtocol::decode(RemoteReceiveData src) {
   // *** Packet 1
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
-  for (uint8_t bit_counter = 0; bit_counter < 48; bit_counter++) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      packet = (packet << 1) | 1;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      packet = (packet << 1) | 0;
-    } else {
-      return {};
-    }
-  }
+  auto packet = src.read_soft_bits(48, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!packet.has_value())
+    return {};
   if (!src.expect_item(FOOTER_HIGH_US, PACKET_SPACE))
     return {};
 
   // *** Packet 2
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
-  for (uint8_t bit_counter = 0; bit_counter < 48; bit_counter++) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.rc_code_1 = (out.rc_code_1 << 1) | 1;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.rc_code_1 = (out.rc_code_1 << 1) | 0;
-    } else {
-      return {};
-    }
-  }
-  // The first two packets must match
-  if (packet != out.rc_code_1)
+  auto copy = src.read_soft_bits(48, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!copy.has_value())
+    return {};
+  // The first two packets must match, with error correction either one fills in the bits the other could not decode
+  if ((packet->erasures | copy->erasures) != 0 && !src.is_error_correcting())
     return {};
+  auto rc_code_1 = packet->merge(*copy, false);
+  if (!rc_code_1.has_value())
+    return {};
+  out.rc_code_1 = *rc_code_1;
   // The third packet isn't always present
   if (!src.expect_item(FOOTER_HIGH_US, PACKET_SPACE))
     return out;
@@ -90,15 +70,10 @@ optional<ToshibaAcData> ToshibaAcProtocol::decode(RemoteReceiveData src) {
   // *** Packet 3
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
     return {};
-  for (uint8_t bit_counter = 0; bit_counter < 48; bit_counter++) {
-    if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
-      out.rc_code_2 = (out.rc_code_2 << 1) | 1;
-    } else if (src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
-      out.rc_code_2 = (out.rc_code_2 << 1) | 0;
-    } else {
-      return {};
-    }
-  }
+  auto rc_code_2 = src.read_bits(48, BIT_ORDER_MSB_FIRST, BIT_TIMING);
+  if (!rc_code_2.has_value())
+    return {};
+  out.rc_code_2 = *rc_code_2;
 
   return out;
 }
@@ -113,3 +88,5 @@ void ToshibaAcProtocol::dump(const ToshibaAcData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_TOSHIBA_AC
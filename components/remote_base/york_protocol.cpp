@@ -1,6 +1,9 @@
 #include "york_protocol.h"
+#include "pulse_distance.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_BASE_YORK
+
 namespace esphome {
 namespace remote_base {
 
@@ -21,59 +24,35 @@ static const uint32_t BIT_ZERO_LOW_US = 368;
 
 static const uint32_t END_PULS = 20340;
 
-uint8_t YorkData::calc_cs_() const {
+static constexpr PulseDistanceCodec CODEC({HEADER_HIGH_US, HEADER_LOW_US, BIT_HIGH_US, BIT_ONE_LOW_US, BIT_ZERO_LOW_US,
+                                           BIT_ORDER_LSB_FIRST});
+
+uint8_t YorkChecksum::calc(const uint8_t *data) {
   uint8_t cs = 0;
-  for (uint8_t idx = 0; idx <= OFFSET_CS; idx++) {
-    cs += selectRightNibble(this->data_[idx]);
-    if (idx < 7)
-      cs += selectLeftNibble(this->data_[idx]);
+  for (uint8_t idx = 0; idx <= Field::BYTE; idx++) {
+    cs += selectRightNibble(data[idx]);
+    if (idx < Field::BYTE)
+      cs += selectLeftNibble(data[idx]);
   }
   return selectRightNibble(cs);
 }
 
-
-bool YorkData::is_compliment(const YorkData &rhs) const {
-  return std::equal(this->data_.begin(), this->data_.end(), rhs.data_.begin(),
-                    [](const uint8_t &a, const uint8_t &b) { return a + b == 255; });
-}
-
 void YorkProtocol::encode(RemoteTransmitData *dst, const YorkData &src) {
   dst->set_carrier_frequency(38000);
   dst->reserve(2 + 64 + 64 + 3);
   ESP_LOGI(TAG, "Transmit York: %s", src.to_string().c_str());
-  dst->item(HEADER_HIGH_US, HEADER_LOW_US);
-  for (uint8_t idx = 0; idx < 8; idx++) {
-    for (uint8_t mask = 1UL; mask != 0; mask <<= 1)
-      dst->item(BIT_HIGH_US, (src[idx] & mask) ? BIT_ONE_LOW_US : BIT_ZERO_LOW_US);
-  }
+  CODEC.encode_header(dst);
+  CODEC.encode_frame(dst, src);
 
   dst->item(BIT_HIGH_US, END_PULS);
   dst->mark(HEADER_HIGH_US);
 }
 
 
-static bool decode_data(RemoteReceiveData &src, YorkData &dst) {
-  for (unsigned idx = 0; idx < 8; idx++) {
-    uint8_t data = 0;
-    for (uint8_t mask = 1UL; mask != 0; mask <<= 1) {
-      if (!src.expect_mark(BIT_HIGH_US))
-        return false;
-      if (src.expect_space(BIT_ONE_LOW_US)) {
-        data |= mask;
-      } else if (!src.expect_space(BIT_ZERO_LOW_US)) {
-        return false;
-      }
-    }
-    dst[idx] = data;
-  }
-  return true;
-}
-
 optional<YorkData> YorkProtocol::decode(RemoteReceiveData src) {
   YorkData out;
-  
 
-  if (src.expect_item(HEADER_HIGH_US, HEADER_LOW_US) && decode_data(src, out) && out.is_valid() &&
+  if (CODEC.decode_header(src) && CODEC.decode_frame(src, out) &&
       src.expect_item(BIT_HIGH_US, END_PULS) && src.expect_mark(HEADER_HIGH_US))
     return out;
   return {};
@@ -83,3 +62,5 @@ void YorkProtocol::dump(const YorkData &data) { ESP_LOGI(TAG, "Received York: %s
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif  // USE_REMOTE_BASE_YORK
@@ -0,0 +1,176 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import remote_base
+from esphome.const import (
+    CONF_DELAY,
+    CONF_DUMP,
+    CONF_DURATION,
+    CONF_ID,
+    CONF_TOLERANCE,
+)
+
+AUTO_LOAD = ["remote_base"]
+MULTI_CONF = True
+
+CONF_JITTER = "jitter"
+CONF_NOISE = "noise"
+CONF_QUEUE_SIZE = "queue_size"
+CONF_TRAFFIC = "traffic"
+CONF_RATE = "rate"
+CONF_MIX = "mix"
+CONF_REPORT_INTERVAL = "report_interval"
+CONF_CODEC_BENCHMARK = "codec_benchmark"
+CONF_ITERATIONS = "iterations"
+
+remote_loopback_ns = cg.esphome_ns.namespace("remote_loopback")
+LoopbackTransmitter = remote_loopback_ns.class_(
+    "LoopbackTransmitter", remote_base.RemoteTransmitterBase, cg.Component
+)
+LoopbackReceiver = remote_loopback_ns.class_(
+    "LoopbackReceiver", remote_base.RemoteReceiverBase, cg.Component
+)
+LoopbackTrafficGenerator = remote_loopback_ns.class_(
+    "LoopbackTrafficGenerator", cg.Component
+)
+TrafficType = remote_loopback_ns.enum("TrafficType")
+CodecBenchmark = remote_loopback_ns.class_("CodecBenchmark", cg.Component)
+
+# Protocols the codec benchmark has a case for
+BENCHMARK_PROTOCOLS = [
+    "abbwelcome",
+    "aeha",
+    "byronsx",
+    "canalsat",
+    "canalsatld",
+    "coolix",
+    "dish",
+    "dooya",
+    "drayton",
+    "haier",
+    "jvc",
+    "keeloq",
+    "lg",
+    "magiquest",
+    "midea",
+    "mirage",
+    "nec",
+    "nexa",
+    "panasonic",
+    "pioneer",
+    "pronto",
+    "rc5",
+    "rc6",
+    "rc_switch",
+    "roomba",
+    "samsung",
+    "samsung36",
+    "sony",
+    "toshiba_ac",
+    "york",
+]
+
+# Traffic type: (enum value, protocol to compile in)
+TRAFFIC_TYPES = {
+    "nec": (TrafficType.TRAFFIC_NEC, "nec"),
+    "rc_switch": (TrafficType.TRAFFIC_RC_SWITCH, "rc_switch"),
+    "coolix": (TrafficType.TRAFFIC_COOLIX, "coolix"),
+    "york": (TrafficType.TRAFFIC_YORK, "york"),
+    "noise": (TrafficType.TRAFFIC_NOISE, None),
+}
+
+TRAFFIC_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(LoopbackTrafficGenerator),
+        cv.Required(CONF_RATE): cv.int_range(min=1, max=10000),
+        cv.Required(CONF_MIX): cv.All(
+            {cv.one_of(*TRAFFIC_TYPES, lower=True): cv.int_range(min=1, max=255)},
+            cv.Length(min=1),
+        ),
+        cv.Optional(CONF_DURATION): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_REPORT_INTERVAL, default="10s"
+        ): cv.positive_time_period_milliseconds,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+CODEC_BENCHMARK_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(CodecBenchmark),
+        cv.Optional(CONF_ITERATIONS, default=1000): cv.int_range(min=1),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+# One entry is a transmitter and the receiver it loops back into, actions use the id, listeners the receiver_id
+CONFIG_SCHEMA = remote_base.validate_triggers(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(LoopbackTransmitter),
+            cv.GenerateID(remote_base.CONF_RECEIVER_ID): cv.declare_id(
+                LoopbackReceiver
+            ),
+            cv.Optional(CONF_DUMP, default=[]): remote_base.validate_dumpers,
+            cv.Optional(CONF_TOLERANCE, default="25%"): cv.percentage_int,
+            cv.Optional(
+                CONF_DELAY, default="0ms"
+            ): cv.positive_time_period_microseconds,
+            cv.Optional(CONF_JITTER, default="0%"): cv.All(
+                cv.percentage_int, cv.Range(max=50)
+            ),
+            cv.Optional(CONF_NOISE, default="0%"): cv.percentage,
+            cv.Optional(CONF_QUEUE_SIZE, default=0): cv.positive_int,
+            cv.Optional(CONF_TRAFFIC): TRAFFIC_SCHEMA,
+            cv.Optional(CONF_CODEC_BENCHMARK): CODEC_BENCHMARK_SCHEMA,
+        }
+    )
+    .extend(remote_base.REMOTE_RECEIVER_OPTIONS_SCHEMA)
+    .extend(cv.COMPONENT_SCHEMA)
+)
+
+
+async def to_code(config):
+    receiver = cg.new_Pvariable(config[remote_base.CONF_RECEIVER_ID])
+    await cg.register_component(receiver, config)
+    cg.add(
+        receiver.set_tolerance(
+            config[CONF_TOLERANCE], remote_base.ToleranceMode.TOLERANCE_MODE_PERCENTAGE
+        )
+    )
+    cg.add(receiver.set_queue_size(config[CONF_QUEUE_SIZE]))
+    await remote_base.setup_receiver_options(receiver, config)
+    dumpers = await remote_base.build_dumpers(config[CONF_DUMP])
+    for dumper in dumpers:
+        cg.add(receiver.register_dumper(dumper))
+    triggers = await remote_base.build_triggers(config)
+    for trigger in triggers:
+        cg.add(receiver.register_listener(trigger))
+
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.add_receiver(receiver))
+    cg.add(var.set_delay(config[CONF_DELAY]))
+    cg.add(var.set_jitter(config[CONF_JITTER]))
+    cg.add(var.set_noise(config[CONF_NOISE]))
+
+    if traffic := config.get(CONF_TRAFFIC):
+        generator = cg.new_Pvariable(traffic[CONF_ID], var, receiver)
+        await cg.register_component(generator, traffic)
+        cg.add(generator.set_rate(traffic[CONF_RATE]))
+        if CONF_DURATION in traffic:
+            cg.add(generator.set_duration(traffic[CONF_DURATION]))
+        cg.add(generator.set_report_interval(traffic[CONF_REPORT_INTERVAL]))
+        for name, weight in traffic[CONF_MIX].items():
+            type_, protocol = TRAFFIC_TYPES[name]
+            if protocol is not None:
+                remote_base.request_protocol(protocol)
+            cg.add(generator.add_traffic(type_, weight))
+
+    if benchmark := config.get(CONF_CODEC_BENCHMARK):
+        cg.add_define("USE_REMOTE_LOOPBACK_CODEC_BENCHMARK")
+        cg.add_define("USE_REMOTE_BASE_ALLOC_TRACKING")
+        for protocol in BENCHMARK_PROTOCOLS:
+            remote_base.request_protocol(protocol)
+        bench = cg.new_Pvariable(benchmark[CONF_ID])
+        await cg.register_component(bench, benchmark)
+        cg.add(bench.set_iterations(benchmark[CONF_ITERATIONS]))
+        cg.add(bench.set_tolerance(config[CONF_TOLERANCE]))
@@ -0,0 +1,307 @@
+#include "codec_benchmark.h"
+
+#ifdef USE_REMOTE_LOOPBACK_CODEC_BENCHMARK
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include "esphome/components/remote_base/abbwelcome_protocol.h"
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/byronsx_protocol.h"
+#include "esphome/components/remote_base/canalsat_protocol.h"
+#include "esphome/components/remote_base/coolix_protocol.h"
+#include "esphome/components/remote_base/dish_protocol.h"
+#include "esphome/components/remote_base/dooya_protocol.h"
+#include "esphome/components/remote_base/drayton_protocol.h"
+#include "esphome/components/remote_base/haier_protocol.h"
+#include "esphome/components/remote_base/jvc_protocol.h"
+#include "esphome/components/remote_base/keeloq_protocol.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/magiquest_protocol.h"
+#include "esphome/components/remote_base/midea_protocol.h"
+#include "esphome/components/remote_base/mirage_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/nexa_protocol.h"
+#include "esphome/components/remote_base/panasonic_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/pronto_protocol.h"
+#include "esphome/components/remote_base/rc5_protocol.h"
+#include "esphome/components/remote_base/rc6_protocol.h"
+#include "esphome/components/remote_base/rc_switch_protocol.h"
+#include "esphome/components/remote_base/roomba_protocol.h"
+#include "esphome/components/remote_base/samsung36_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+#include "esphome/components/remote_base/toshiba_ac_protocol.h"
+#include "esphome/components/remote_base/york_protocol.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace remote_loopback {
+
+using namespace remote_base;
+
+static const char *const TAG = "remote_loopback.benchmark";
+
+// Keeps the optimizer from dropping decode results
+static volatile uint32_t benchmark_sink = 0;  // NOLINT
+
+// Frames of other protocol families for the mismatch path, a protocol is measured against the first it rejects
+static RawTimings pulse_distance_frame() {
+  RawTimings frame{9000, -4500};
+  for (uint8_t bit = 0; bit < 32; bit++) {
+    frame.push_back(560);
+    frame.push_back(bit % 3 == 0 ? -1690 : -560);
+  }
+  frame.push_back(560);
+  return frame;
+}
+
+static RawTimings bi_phase_frame() {
+  RawTimings frame;
+  for (uint8_t bit = 0; bit < 14; bit++) {
+    frame.push_back(bit % 4 == 1 ? 1778 : 889);
+    frame.push_back(bit % 4 == 2 ? -1778 : -889);
+  }
+  return frame;
+}
+
+// Receivers see one level per pulse, so encoders that emit bi-phase half bits separately get joined. Capture starts at
+// the first mark and, depending on the hardware, ends at the last mark or includes part of the idle after it.
+// Decoders are written against one of these, so try each shape of the sent frame.
+static const uint32_t IDLE_US = 10000;
+
+static std::vector<RawTimings> received_shapes(const RawTimings &sent) {
+  RawTimings joined;
+  for (int32_t value : sent) {
+    if (!joined.empty() && (joined.back() < 0) == (value < 0)) {
+      joined.back() += value;
+    } else {
+      joined.push_back(value);
+    }
+  }
+  auto begin = joined.begin();
+  auto end = joined.end();
+  while (begin != end && *begin <= 0)
+    begin++;
+  std::vector<RawTimings> shapes{sent, joined, RawTimings(begin, end)};
+  while (end != begin && *(end - 1) <= 0)
+    end--;
+  shapes.emplace_back(begin, end);
+  shapes.push_back(shapes.back());
+  shapes.back().push_back(-int32_t(IDLE_US));
+  return shapes;
+}
+
+template<typename F> void CodecBenchmark::measure_(const char *name, const char *op, F &&func) {
+  func();  // warm up, first calls may allocate lazily
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+  const uint32_t allocations = AllocTracker::get_allocations();
+#endif
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < this->iterations_; i++)
+    func();
+  const uint32_t elapsed = micros() - start;
+  const float ns_per_op = elapsed * 1000.0f / this->iterations_;
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+  const float allocs_per_op = float(AllocTracker::get_allocations() - allocations) / this->iterations_;
+  ESP_LOGI(TAG,
+           R"({"protocol":"%s","op":"%s","iterations":%)" PRIu32 R"(,"ns_per_op":%.1f,"allocs_per_op":%.2f})",
+           name, op, this->iterations_, ns_per_op, allocs_per_op);
+#else
+  ESP_LOGI(TAG, R"({"protocol":"%s","op":"%s","iterations":%)" PRIu32 R"(,"ns_per_op":%.1f,"allocs_per_op":null})",
+           name, op, this->iterations_, ns_per_op);
+#endif
+  yield();
+}
+
+template<typename E, typename D> void CodecBenchmark::run_(const char *name, E &&encode, D &&decode) {
+  RemoteTransmitData dst;
+  this->measure_(name, "encode", [&dst, &encode]() {
+    dst.reset();
+    encode(&dst);
+  });
+
+  const uint32_t tolerance = this->tolerance_;
+  RawTimings frame;
+  for (auto &shape : received_shapes(dst.get_data())) {
+    if (decode(RemoteReceiveData(shape, tolerance, TOLERANCE_MODE_PERCENTAGE))) {
+      frame = std::move(shape);
+      break;
+    }
+  }
+  if (frame.empty()) {
+    ESP_LOGW(TAG, "%s does not decode its own frame", name);
+    return;
+  }
+  this->measure_(name, "decode_match", [&frame, &decode, tolerance]() {
+    benchmark_sink = benchmark_sink + decode(RemoteReceiveData(frame, tolerance, TOLERANCE_MODE_PERCENTAGE));
+  });
+
+  for (const RawTimings &foreign : {pulse_distance_frame(), bi_phase_frame()}) {
+    if (decode(RemoteReceiveData(foreign, tolerance, TOLERANCE_MODE_PERCENTAGE)))
+      continue;
+    this->measure_(name, "decode_mismatch", [&foreign, &decode, tolerance]() {
+      benchmark_sink = benchmark_sink + decode(RemoteReceiveData(foreign, tolerance, TOLERANCE_MODE_PERCENTAGE));
+    });
+    return;
+  }
+  ESP_LOGW(TAG, "%s accepts all foreign frames, no mismatch measurement", name);
+}
+
+template<typename P> void CodecBenchmark::run_protocol_(const char *name, const typename P::ProtocolData &data) {
+  P protocol;
+  this->run_(
+      name, [&protocol, &data](RemoteTransmitData *dst) { protocol.encode(dst, data); },
+      [&protocol](RemoteReceiveData src) { return protocol.decode(src).has_value(); });
+}
+
+void CodecBenchmark::setup() {
+  ESP_LOGI(TAG, "Running codec benchmark, %" PRIu32 " iterations per measurement", this->iterations_);
+
+  // One case per protocol source, raw has no codec
+#ifdef USE_REMOTE_BASE_ABBWELCOME
+  {
+    ABBWelcomeData data;
+    data.set_source_address(0x1001);
+    data.set_destination_address(0x4001);
+    data.set_message_type(0x8d);
+    data.set_data({0x00});
+    data.finalize();
+    this->run_protocol_<ABBWelcomeProtocol>("abbwelcome", data);
+  }
+#endif
+#ifdef USE_REMOTE_BASE_AEHA
+  this->run_protocol_<AEHAProtocol>("aeha", {0x2002, {0x80, 0x00, 0x49, 0x49, 0x12, 0x34}});
+#endif
+#ifdef USE_REMOTE_BASE_BYRONSX
+  this->run_protocol_<ByronSXProtocol>("byronsx", {0x12, 0x01});
+#endif
+#ifdef USE_REMOTE_BASE_CANALSAT
+  {
+    CanalSatData data{};
+    data.device = 0x1B;
+    data.address = 0x01;
+    data.command = 0x10;
+    this->run_protocol_<CanalSatProtocol>("canalsat", data);
+  }
+#endif
+#ifdef USE_REMOTE_BASE_CANALSATLD
+  {
+    CanalSatData data{};
+    data.device = 0x1B;
+    data.address = 0x01;
+    data.command = 0x10;
+    this->run_protocol_<CanalSatLDProtocol>("canalsatld", data);
+  }
+#endif
+#ifdef USE_REMOTE_BASE_COOLIX
+  this->run_protocol_<CoolixProtocol>("coolix", CoolixData(0xB2BF40));
+#endif
+#ifdef USE_REMOTE_BASE_DISH
+  this->run_protocol_<DishProtocol>("dish", {0x01, 0x10});
+#endif
+#ifdef USE_REMOTE_BASE_DOOYA
+  this->run_protocol_<DooyaProtocol>("dooya", {0x123456, 0x01, 0x01, 0x01});
+#endif
+#ifdef USE_REMOTE_BASE_DRAYTON
+  this->run_protocol_<DraytonProtocol>("drayton", {0x1234, 0x01, 0x02});
+#endif
+#ifdef USE_REMOTE_BASE_HAIER
+  this->run_protocol_<HaierProtocol>(
+      "haier", {{0xA6, 0x12, 0x00, 0x00, 0x40, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05}});
+#endif
+#ifdef USE_REMOTE_BASE_JVC
+  this->run_protocol_<JVCProtocol>("jvc", {0xC2D0});
+#endif
+#ifdef USE_REMOTE_BASE_KEELOQ
+  this->run_protocol_<KeeloqProtocol>("keeloq", {0x12345678, 0x0ABCDEF, 0x02, false, false});
+#endif
+#ifdef USE_REMOTE_BASE_LG
+  this->run_protocol_<LGProtocol>("lg", {0x20DF10EF, 32});
+#endif
+#ifdef USE_REMOTE_BASE_MAGIQUEST
+  this->run_protocol_<MagiQuestProtocol>("magiquest", {0x0102, 0x12345678});
+#endif
+#ifdef USE_REMOTE_BASE_MIDEA
+  {
+    MideaData data({0xA1, 0x82, 0x48, 0xFF, 0xFF});
+    data.finalize();
+    this->run_protocol_<MideaProtocol>("midea", data);
+  }
+#endif
+#ifdef USE_REMOTE_BASE_MIRAGE
+  this->run_protocol_<MirageProtocol>(
+      "mirage", {{0x56, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x14, 0x26, 0x00, 0x00}});
+#endif
+#ifdef USE_REMOTE_BASE_NEC
+  this->run_protocol_<NECProtocol>("nec", {0x1234, 0x5678, 1});
+#endif
+#ifdef USE_REMOTE_BASE_NEXA
+  this->run_protocol_<NexaProtocol>("nexa", {0x1234567, 0, 1, 2, 0});
+#endif
+#ifdef USE_REMOTE_BASE_PANASONIC
+  this->run_protocol_<PanasonicProtocol>("panasonic", {0x4004, 0x100BCBD});
+#endif
+#ifdef USE_REMOTE_BASE_PIONEER
+  this->run_protocol_<PioneerProtocol>("pioneer", {0xA556, 0x0000});
+#endif
+#ifdef USE_REMOTE_BASE_PRONTO
+  this->run_protocol_<ProntoProtocol>(
+      "pronto", {"0000 006D 0022 0000 0157 00AC 0015 0016 0015 0016 0015 0041 0015 0016 0015 0016 0015 0016 0015 "
+                 "0016 0015 0016 0015 0041 0015 0041 0015 0016 0015 0041 0015 0041 0015 0041 0015 0041 0015 0041 "
+                 "0015 0016 0015 0016 0015 0016 0015 0041 0015 0016 0015 0016 0015 0016 0015 0016 0015 0041 0015 "
+                 "0041 0015 0041 0015 0016 0015 0041 0015 0041 0015 0041 0015 0041 0015 0689",
+                 0});
+#endif
+#ifdef USE_REMOTE_BASE_RC5
+  this->run_protocol_<RC5Protocol>("rc5", {0x05, 0x35});
+#endif
+#ifdef USE_REMOTE_BASE_RC6
+  {
+    RC6Data data{};
+    data.address = 0x04;
+    data.command = 0x0C;
+    this->run_protocol_<RC6Protocol>("rc6", data);
+  }
+#endif
+#ifdef USE_REMOTE_BASE_RC_SWITCH
+  this->run_(
+      "rc_switch", [](RemoteTransmitData *dst) { RC_SWITCH_PROTOCOLS[1].transmit(dst, 0x5A5A5A, 24); },
+      [](RemoteReceiveData src) { return RC_SWITCH_PROTOCOLS[1].decode(src).has_value(); });
+#endif
+#ifdef USE_REMOTE_BASE_ROOMBA
+  this->run_protocol_<RoombaProtocol>("roomba", {0x88});
+#endif
+#ifdef USE_REMOTE_BASE_SAMSUNG36
+  this->run_protocol_<Samsung36Protocol>("samsung36", {0x0400, 0x4BD0B});
+#endif
+#ifdef USE_REMOTE_BASE_SAMSUNG
+  this->run_protocol_<SamsungProtocol>("samsung", {0xE0E040BF, 32});
+#endif
+#ifdef USE_REMOTE_BASE_SONY
+  this->run_protocol_<SonyProtocol>("sony", {0xA90, 12});
+#endif
+#ifdef USE_REMOTE_BASE_TOSHIBA_AC
+  this->run_protocol_<ToshibaAcProtocol>("toshiba_ac", {0xB24DBF4040BF, 0xD5660001003A});
+#endif
+#ifdef USE_REMOTE_BASE_YORK
+  {
+    YorkData data({0x16, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC});
+    data.finalize();
+    this->run_protocol_<YorkProtocol>("york", data);
+  }
+#endif
+
+  ESP_LOGI(TAG, "Codec benchmark done");
+}
+
+void CodecBenchmark::dump_config() {
+  ESP_LOGCONFIG(TAG, "Codec Benchmark:");
+  ESP_LOGCONFIG(TAG, "  Iterations: %" PRIu32, this->iterations_);
+  ESP_LOGCONFIG(TAG, "  Tolerance: %" PRIu32 "%%", this->tolerance_);
+}
+
+}  // namespace remote_loopback
+}  // namespace esphome
+#endif  // USE_REMOTE_LOOPBACK_CODEC_BENCHMARK
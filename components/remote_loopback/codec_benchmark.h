@@ -0,0 +1,32 @@
+#pragma once
+
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace remote_loopback {
+
+/// Times encode(), decode() of the protocol's own frame and decode() of a foreign frame for every protocol compiled
+/// into remote_base and logs one JSON object per measurement, e.g.
+///   {"protocol":"nec","op":"decode_mismatch","iterations":1000,"ns_per_op":85.0,"allocs_per_op":0.00}
+/// allocs_per_op is null unless allocation tracking is compiled in.
+class CodecBenchmark : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_iterations(uint32_t iterations) { this->iterations_ = iterations; }
+  void set_tolerance(uint32_t tolerance) { this->tolerance_ = tolerance; }
+
+ protected:
+  template<typename P> void run_protocol_(const char *name, const typename P::ProtocolData &data);
+  template<typename E, typename D> void run_(const char *name, E &&encode, D &&decode);
+  template<typename F> void measure_(const char *name, const char *op, F &&func);
+
+  uint32_t iterations_{1000};
+  uint32_t tolerance_{25};
+};
+
+}  // namespace remote_loopback
+}  // namespace esphome
@@ -0,0 +1,303 @@
+#include "remote_loopback.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_REMOTE_BASE_COOLIX
+#include "esphome/components/remote_base/coolix_protocol.h"
+#endif
+#ifdef USE_REMOTE_BASE_NEC
+#include "esphome/components/remote_base/nec_protocol.h"
+#endif
+#ifdef USE_REMOTE_BASE_RC_SWITCH
+#include "esphome/components/remote_base/rc_switch_protocol.h"
+#endif
+#ifdef USE_REMOTE_BASE_YORK
+#include "esphome/components/remote_base/york_protocol.h"
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+
+#if defined(USE_HOST) && defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(USE_ESP32)
+#include <esp_heap_caps.h>
+#endif
+
+namespace esphome {
+namespace remote_loopback {
+
+static const char *const TAG = "remote_loopback";
+
+// Glitches the noise model produces, just below what real receivers reliably resolve
+static const uint32_t GLITCH_MIN_US = 10;
+static const uint32_t GLITCH_MAX_US = 80;
+// Most frames the traffic generator sends in one loop to catch up with its schedule
+static const uint32_t MAX_BURST = 16;
+
+static uint32_t random_range(uint32_t lo, uint32_t hi) { return lo + random_uint32() % (hi - lo + 1); }
+
+// Bytes allocated on the heap, 0 where the platform does not tell
+static size_t heap_in_use() {
+#if defined(USE_HOST) && defined(__GLIBC__)
+  return mallinfo2().uordblks;
+#elif defined(USE_ESP32)
+  return heap_caps_get_total_size(MALLOC_CAP_DEFAULT) - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#else
+  return 0;
+#endif
+}
+
+void LoopbackReceiver::receive(remote_base::RawTimings &&timings, uint32_t due) {
+  if (this->queue_size_ > 0 && this->queue_.size() >= this->queue_size_) {
+    this->dropped_++;
+    return;
+  }
+  this->queue_.push_back({due, std::move(timings)});
+  this->queue_high_water_ = std::max(this->queue_high_water_, this->queue_.size());
+  this->high_freq_.start();
+}
+
+void LoopbackReceiver::loop() {
+  while (!this->queue_.empty() && int32_t(micros() - this->queue_.front().due) >= 0) {
+    const uint32_t due = this->queue_.front().due;
+    // swap keeps the capacity of temp_ around for the next frame
+    std::swap(this->temp_, this->queue_.front().timings);
+    this->queue_.pop_front();
+    ESP_LOGVV(TAG, "Received %u timings", (unsigned) this->temp_.size());
+    this->received_++;
+    if (!this->call_listeners_dumpers_())
+      this->undecoded_++;
+    if (!this->latencies_.empty()) {
+      this->latencies_[this->latency_count_++ % this->latencies_.size()] = micros() - due;
+      this->heap_high_water_ = std::max(this->heap_high_water_, heap_in_use());
+    }
+  }
+  if (this->queue_.empty())
+    this->high_freq_.stop();
+}
+
+void LoopbackReceiver::enable_stats(size_t samples) {
+  this->latencies_.assign(samples, 0);
+  this->reset_stats();
+}
+
+void LoopbackReceiver::reset_stats() {
+  this->received_ = 0;
+  this->dropped_ = 0;
+  this->undecoded_ = 0;
+  this->queue_high_water_ = this->queue_.size();
+  this->heap_high_water_ = heap_in_use();
+  this->latency_count_ = 0;
+}
+
+void LoopbackReceiver::log_stats() {
+  ESP_LOGI(TAG, "Received %" PRIu32 ", dropped %" PRIu32 ", undecoded %" PRIu32 ", queue high water %u",
+           this->received_, this->dropped_, this->undecoded_, (unsigned) this->queue_high_water_);
+  const size_t count = std::min(this->latency_count_, this->latencies_.size());
+  if (count == 0)
+    return;
+  std::vector<uint32_t> sorted(this->latencies_.begin(), this->latencies_.begin() + count);
+  auto percentile = [&sorted, count](uint32_t per_mille) {
+    auto nth = sorted.begin() + std::min<size_t>(count * per_mille / 1000, count - 1);
+    std::nth_element(sorted.begin(), nth, sorted.end());
+    return *nth;
+  };
+  ESP_LOGI(TAG, "Dispatch latency p50 %" PRIu32 "us, p99 %" PRIu32 "us, p999 %" PRIu32 "us over %u frames",
+           percentile(500), percentile(990), percentile(999), (unsigned) count);
+  if (this->heap_high_water_ > 0)
+    ESP_LOGI(TAG, "Heap high water %u bytes", (unsigned) this->heap_high_water_);
+#ifdef USE_REMOTE_BASE_INLINE_TIMINGS
+  if (remote_base::inline_buffer_overflows() > 0)
+    ESP_LOGW(TAG, "%" PRIu32 " timings did not fit the inline buffers", remote_base::inline_buffer_overflows());
+#endif
+#ifdef USE_REMOTE_BASE_ALLOC_TRACKING
+  remote_base::AllocTracker::log_stats();
+#endif
+}
+
+void LoopbackReceiver::dump_config() {
+  ESP_LOGCONFIG(TAG, "Loopback Receiver:");
+  ESP_LOGCONFIG(TAG, "  Tolerance: %" PRIu32 "%s", this->tolerance_,
+                this->tolerance_mode_ == remote_base::TOLERANCE_MODE_TIME ? "us" : "%");
+  if (this->queue_size_ > 0)
+    ESP_LOGCONFIG(TAG, "  Queue size: %u", (unsigned) this->queue_size_);
+  if (this->glitch_filter_ > 0)
+    ESP_LOGCONFIG(TAG, "  Glitch filter: %" PRIu32 "us", this->glitch_filter_);
+  if (this->repeat_cache_timeout_ > 0)
+    ESP_LOGCONFIG(TAG, "  Repeat cache timeout: %" PRIu32 "ms", this->repeat_cache_timeout_);
+}
+
+void LoopbackTransmitter::dump_config() {
+  ESP_LOGCONFIG(TAG, "Loopback Transmitter:");
+  ESP_LOGCONFIG(TAG, "  Receivers: %u", (unsigned) this->receivers_.size());
+  ESP_LOGCONFIG(TAG, "  Delay: %" PRIu32 "us", this->delay_);
+  ESP_LOGCONFIG(TAG, "  Jitter: %u%%", this->jitter_);
+  ESP_LOGCONFIG(TAG, "  Noise: %.0f%%", this->noise_ * 100.0f);
+}
+
+void LoopbackTransmitter::send_internal(uint32_t send_times, uint32_t send_wait) {
+  const auto &data = this->temp_.get_data();
+  uint32_t length = 0;
+  for (int32_t value : data)
+    length += std::abs(value);
+
+  // Like on air, a frame can only start once the previous one is out and repeats follow back to back
+  const uint32_t now = micros();
+  uint32_t due = int32_t(this->busy_until_ - now) > 0 ? this->busy_until_ : now;
+  for (uint32_t i = 0; i < send_times; i++) {
+    due += length;
+    for (auto *receiver : this->receivers_) {
+      remote_base::RawTimings frame = data;
+      this->distort_(frame);
+      receiver->receive(std::move(frame), due + this->delay_);
+    }
+    due += send_wait;
+  }
+  this->busy_until_ = due;
+}
+
+void LoopbackTransmitter::distort_(remote_base::RawTimings &timings) {
+  if (this->jitter_ > 0) {
+    for (int32_t &value : timings) {
+      const int32_t percent = int32_t(random_range(0, 2 * this->jitter_)) - this->jitter_;
+      value += value * percent / 100;
+    }
+  }
+  if (this->noise_ <= 0.0f || timings.size() < 2 || random_float() >= this->noise_)
+    return;
+
+  // Split one pulse by a glitch of the opposite level
+  const size_t idx = random_range(0, timings.size() - 1);
+  const int32_t value = timings[idx];
+  const int32_t glitch = random_range(GLITCH_MIN_US, GLITCH_MAX_US);
+  const int32_t head = std::abs(value) / 2;
+  const int32_t tail = std::max<int32_t>(std::abs(value) - head - glitch, 1);
+  const int32_t sign = value < 0 ? -1 : 1;
+  timings[idx] = sign * head;
+  timings.insert(timings.begin() + idx + 1, {-sign * glitch, sign * tail});
+
+  // and put a short burst of garbage in front of the frame
+  remote_base::RawTimings burst;
+  const uint32_t count = random_range(1, 4);
+  for (uint32_t i = 0; i < count; i++) {
+    burst.push_back(random_range(GLITCH_MIN_US, 4 * GLITCH_MAX_US));
+    burst.push_back(-int32_t(random_range(200, 2000)));
+  }
+  timings.insert(timings.begin(), burst.begin(), burst.end());
+}
+
+void LoopbackTrafficGenerator::setup() {
+  this->receiver_->enable_stats(4096);
+  this->start_ = millis();
+  this->next_ = micros();
+  this->running_ = this->total_weight_ > 0 && this->rate_ > 0;
+  if (this->running_)
+    this->high_freq_.start();
+  this->set_interval("report", this->report_interval_, [this]() {
+    if (this->running_)
+      this->report_();
+  });
+}
+
+void LoopbackTrafficGenerator::loop() {
+  if (!this->running_)
+    return;
+  if (this->duration_ > 0 && millis() - this->start_ >= this->duration_) {
+    this->running_ = false;
+    this->high_freq_.stop();
+    ESP_LOGI(TAG, "Traffic finished");
+    this->report_();
+    return;
+  }
+  // Send every frame that is due since the last loop, but after a stall of more than MAX_BURST frames count the
+  // rest as late and pick the schedule up from now instead of flooding the receiver
+  const uint32_t now = micros();
+  const uint32_t period = 1000000 / this->rate_;
+  if (int32_t(now - this->next_) < 0)
+    return;
+  const uint32_t behind = (now - this->next_) / period + 1;
+  if (behind > MAX_BURST) {
+    this->late_ += behind - MAX_BURST;
+    this->next_ = now - (MAX_BURST - 1) * period;
+  }
+  while (int32_t(now - this->next_) >= 0) {
+    this->next_ += period;
+    uint32_t pick = random_uint32() % this->total_weight_;
+    for (const auto &entry : this->mix_) {
+      if (pick < entry.second) {
+        this->send_(entry.first);
+        break;
+      }
+      pick -= entry.second;
+    }
+    this->sent_++;
+  }
+}
+
+void LoopbackTrafficGenerator::send_(TrafficType type) {
+  switch (type) {
+#ifdef USE_REMOTE_BASE_NEC
+    case TRAFFIC_NEC: {
+      // Held buttons send the same code again
+      const remote_base::NECData data{uint16_t(random_uint32()), uint16_t(random_uint32()), 1};
+      this->transmitter_->transmit<remote_base::NECProtocol>(data, random_range(1, 3), 40000);
+      break;
+    }
+#endif
+#ifdef USE_REMOTE_BASE_RC_SWITCH
+    case TRAFFIC_RC_SWITCH: {
+      auto call = this->transmitter_->transmit();
+      remote_base::RC_SWITCH_PROTOCOLS[1].transmit(call.get_data(), random_uint32() & 0xFFFFFF, 24);
+      call.set_send_times(random_range(3, 8));
+      call.perform();
+      break;
+    }
+#endif
+#ifdef USE_REMOTE_BASE_COOLIX
+    case TRAFFIC_COOLIX:
+      this->transmitter_->transmit<remote_base::CoolixProtocol>(remote_base::CoolixData(random_uint32() & 0xFFFFFF));
+      break;
+#endif
+#ifdef USE_REMOTE_BASE_YORK
+    case TRAFFIC_YORK: {
+      remote_base::YorkData data;
+      for (uint8_t idx = 0; idx < data.size(); idx++)
+        data[idx] = random_uint32();
+      data.finalize();
+      this->transmitter_->transmit<remote_base::YorkProtocol>(data);
+      break;
+    }
+#endif
+    case TRAFFIC_NOISE: {
+      auto call = this->transmitter_->transmit();
+      const uint32_t count = random_range(4, 60);
+      for (uint32_t i = 0; i < count; i++)
+        call.get_data()->item(random_range(GLITCH_MIN_US, 3000), random_range(GLITCH_MIN_US, 3000));
+      call.perform();
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void LoopbackTrafficGenerator::report_() {
+  const uint32_t elapsed = millis() - this->start_;
+  ESP_LOGI(TAG, "Sent %" PRIu32 " frames in %" PRIu32 "s (%.1f/s), %" PRIu32 " late", this->sent_, elapsed / 1000,
+           elapsed > 0 ? this->sent_ * 1000.0f / elapsed : 0.0f, this->late_);
+  this->receiver_->log_stats();
+}
+
+void LoopbackTrafficGenerator::dump_config() {
+  ESP_LOGCONFIG(TAG, "Loopback Traffic Generator:");
+  ESP_LOGCONFIG(TAG, "  Rate: %" PRIu32 " frames/s", this->rate_);
+  if (this->duration_ > 0)
+    ESP_LOGCONFIG(TAG, "  Duration: %" PRIu32 "s", this->duration_ / 1000);
+  ESP_LOGCONFIG(TAG, "  Report interval: %" PRIu32 "s", this->report_interval_ / 1000);
+}
+
+}  // namespace remote_loopback
+}  // namespace esphome
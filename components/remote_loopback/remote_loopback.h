@@ -0,0 +1,130 @@
+#pragma once
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace remote_loopback {
+
+/// Software receiver, frames are handed to it by a LoopbackTransmitter instead of being captured from a pin.
+class LoopbackReceiver : public remote_base::RemoteReceiverBase, public Component {
+ public:
+  LoopbackReceiver() : RemoteReceiverBase(nullptr) {}
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  /// Queue a frame to be dispatched once micros() has reached due.
+  void receive(remote_base::RawTimings &&timings, uint32_t due);
+  size_t get_queue_depth() const { return this->queue_.size(); }
+  /// Frames arriving while this many are waiting are dropped, 0 for no limit.
+  void set_queue_size(size_t queue_size) { this->queue_size_ = queue_size; }
+
+  /// Start keeping the dispatch latency of the last samples frames for log_stats().
+  void enable_stats(size_t samples);
+  void reset_stats();
+  void log_stats();
+
+ protected:
+  struct PendingFrame {
+    uint32_t due;
+    remote_base::RawTimings timings;
+  };
+
+  std::deque<PendingFrame> queue_;
+  size_t queue_size_{0};
+  /// Held while frames are queued, so they are dispatched close to when they are due
+  HighFrequencyLoopRequester high_freq_;
+
+  uint32_t received_{0};
+  uint32_t dropped_{0};
+  uint32_t undecoded_{0};
+  size_t queue_high_water_{0};
+  size_t heap_high_water_{0};
+  /// Ring of the most recent times from a frame's arrival to the end of its dispatch, in us
+  std::vector<uint32_t> latencies_;
+  size_t latency_count_{0};
+};
+
+/// Software transmitter that feeds every frame back into its receivers, optionally delayed and distorted with
+/// timing jitter and glitches like a real IR or RF link.
+class LoopbackTransmitter : public remote_base::RemoteTransmitterBase, public Component {
+ public:
+  LoopbackTransmitter() : RemoteTransmitterBase(nullptr) {}
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void add_receiver(LoopbackReceiver *receiver) { this->receivers_.push_back(receiver); }
+  /// Time between the end of send_internal() and the frame reaching the receivers, in us.
+  void set_delay(uint32_t delay) { this->delay_ = delay; }
+  /// Each mark and space is stretched or shrunk by up to this many percent.
+  void set_jitter(uint8_t jitter) { this->jitter_ = jitter; }
+  /// Probability that a frame is hit by noise: a glitch inside a pulse and a burst of garbage before it.
+  void set_noise(float noise) { this->noise_ = noise; }
+
+ protected:
+  void send_internal(uint32_t send_times, uint32_t send_wait) override;
+  void distort_(remote_base::RawTimings &timings);
+
+  std::vector<LoopbackReceiver *> receivers_;
+  uint32_t delay_{0};
+  uint8_t jitter_{0};
+  float noise_{0.0f};
+  /// micros() when the last frame sent is fully on air
+  uint32_t busy_until_{0};
+};
+
+enum TrafficType : uint8_t {
+  TRAFFIC_NEC,
+  TRAFFIC_RC_SWITCH,
+  TRAFFIC_COOLIX,
+  TRAFFIC_YORK,
+  TRAFFIC_NOISE,
+};
+
+/// Drives a loopback pair with a weighted mix of protocol frames and garbage at a fixed rate and periodically logs
+/// the receiver statistics, to find where the receive pipeline saturates.
+class LoopbackTrafficGenerator : public Component {
+ public:
+  LoopbackTrafficGenerator(LoopbackTransmitter *transmitter, LoopbackReceiver *receiver)
+      : transmitter_(transmitter), receiver_(receiver) {}
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_rate(uint32_t rate) { this->rate_ = rate; }
+  /// Stop after this many ms, 0 runs forever.
+  void set_duration(uint32_t duration) { this->duration_ = duration; }
+  void set_report_interval(uint32_t report_interval) { this->report_interval_ = report_interval; }
+  void add_traffic(TrafficType type, uint8_t weight) {
+    this->mix_.emplace_back(type, weight);
+    this->total_weight_ += weight;
+  }
+
+ protected:
+  void send_(TrafficType type);
+  void report_();
+
+  LoopbackTransmitter *transmitter_;
+  LoopbackReceiver *receiver_;
+  std::vector<std::pair<TrafficType, uint8_t>> mix_;
+  uint32_t total_weight_{0};
+  uint32_t rate_{10};
+  uint32_t duration_{0};
+  uint32_t report_interval_{10000};
+  uint32_t start_{0};
+  uint32_t next_{0};
+  uint32_t sent_{0};
+  uint32_t late_{0};
+  bool running_{false};
+  HighFrequencyLoopRequester high_freq_;
+};
+
+}  // namespace remote_loopback
+}  // namespace esphome
@@ -0,0 +1,51 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import remote_base
+from esphome.const import CONF_ID
+
+AUTO_LOAD = ["remote_base"]
+MULTI_CONF = True
+
+CODEOWNERS = ["@panwil"]
+
+york_ir_ns = cg.esphome_ns.namespace("york_ir")
+YorkController = york_ir_ns.class_(
+    "YorkController",
+    cg.Component,
+    remote_base.RemoteReceiverListener,
+    remote_base.RemoteTransmittable,
+)
+
+CONF_FRAME_GAP = "frame_gap"
+CONF_IGNORE_RX_AFTER_TX = "ignore_rx_after_tx"
+
+# One transmitter for several York units, units join with controller_id
+CONFIG_SCHEMA = (
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(YorkController),
+            cv.Optional(remote_base.CONF_RECEIVER_ID): cv.use_id(
+                remote_base.RemoteReceiverBase
+            ),
+            cv.Optional(
+                CONF_FRAME_GAP, default="100ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_IGNORE_RX_AFTER_TX, default="500ms"
+            ): cv.positive_time_period_milliseconds,
+        }
+    )
+    .extend(cv.COMPONENT_SCHEMA)
+    .extend(remote_base.REMOTE_TRANSMITTABLE_SCHEMA)
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await remote_base.register_transmittable(var, config)
+    remote_base.request_protocol("york")
+    if remote_base.CONF_RECEIVER_ID in config:
+        await remote_base.register_listener(var, config)
+    cg.add(var.set_frame_gap(config[CONF_FRAME_GAP]))
+    cg.add(var.set_ignore_rx_after_tx(config[CONF_IGNORE_RX_AFTER_TX]))
@@ -2,20 +2,20 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
 from esphome.components import climate, sensor, remote_base, button
-from esphome.const import CONF_SENSOR, CONF_ID
+from esphome.const import CONF_SENSOR, CONF_ID, CONF_UPDATE_INTERVAL
+from . import YorkController, york_ir_ns
 
 AUTO_LOAD = ["sensor", "remote_base"]
-DEPENDENCIES = ["climate", "remote_transmitter"]
+DEPENDENCIES = ["climate"]
 
 CODEOWNERS = ["@panwil"]
 
 
 
-york_ir_ns = cg.esphome_ns.namespace("york_ir")
 YorkClimateIR = york_ir_ns.class_(
                                     "YorkClimateIR",
                                     climate.Climate,
-                                    cg.PollingComponent,
+                                    cg.Component,
                                     remote_base.RemoteReceiverListener,
                                     remote_base.RemoteTransmittable,
                                 )
@@ -24,6 +24,11 @@ YorkClimateIR = york_ir_ns.class_(
 CONF_YORK_ID = "york_ir_id"
 CONF_IGNOR_RX_AFTER_TX = "ignore_rx_after_tx_ms"
 CONF_DELAY_UPDATE_AFTER_FORZE_POWER_BUTTON = "delay_updata_after_forze_power_button_s"
+CONF_COALESCE_WINDOW = "coalesce_window"
+CONF_CURRENT_TEMPERATURE_DELTA = "current_temperature_delta"
+CONF_SAVE_DELAY = "save_delay"
+CONF_CONTROLLER_ID = "controller_id"
+CONF_FOLLOW_REMOTE = "follow_remote"
 
 CONFIG_SCHEMA = cv.All(
     climate.CLIMATE_SCHEMA.extend(
@@ -33,11 +38,24 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(remote_base.CONF_RECEIVER_ID): cv.use_id(remote_base.RemoteReceiverBase),
             cv.Optional(CONF_IGNOR_RX_AFTER_TX, default=500, ): cv.int_range(min = 1),
             cv.Optional(CONF_DELAY_UPDATE_AFTER_FORZE_POWER_BUTTON, default=90, ): cv.int_range(min = 60),
+            # Changes made within this window are sent as one frame
+            cv.Optional(CONF_COALESCE_WINDOW, default="200ms"): cv.positive_time_period_milliseconds,
+            # Changes of the York frame and power state within this delay cost one flash write
+            cv.Optional(CONF_SAVE_DELAY, default="10s"): cv.positive_time_period_milliseconds,
+            # Smaller changes of the sensor temperature are not published on their own
+            cv.Optional(CONF_CURRENT_TEMPERATURE_DELTA, default=0.1): cv.positive_float,
+            # Send through a shared York controller, frames it receives reach units that follow the remote
+            cv.Optional(CONF_CONTROLLER_ID): cv.use_id(YorkController),
+            cv.Optional(CONF_FOLLOW_REMOTE, default=True): cv.boolean,
+            cv.Optional(CONF_UPDATE_INTERVAL): cv.invalid(
+                "York IR no longer polls, its timeouts are scheduled when they are armed. Remove update_interval."
+            ),
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
-    .extend(remote_base.REMOTE_TRANSMITTABLE_SCHEMA)
-    .extend(cv.polling_component_schema("100ms"))
+    .extend(remote_base.REMOTE_TRANSMITTABLE_SCHEMA),
+    # The controller's receiver serves its units
+    cv.has_at_most_one_key(remote_base.CONF_RECEIVER_ID, CONF_CONTROLLER_ID),
 )
 
 async def to_code(config):
@@ -45,8 +63,12 @@ async def to_code(config):
     await cg.register_component(var, config)
     await climate.register_climate(var, config)
     await remote_base.register_transmittable(var, config)
+    remote_base.request_protocol("york")
     if remote_base.CONF_RECEIVER_ID in config:
         await remote_base.register_listener(var, config)
+    if controller_id := config.get(CONF_CONTROLLER_ID):
+        controller = await cg.get_variable(controller_id)
+        cg.add(controller.register_unit(var, config[CONF_FOLLOW_REMOTE]))
     if sensor_id := config.get(CONF_SENSOR):
         sens = await cg.get_variable(sensor_id)
         cg.add(var.set_sensor(sens))
@@ -58,6 +80,9 @@ async def to_code(config):
         cg.add(
             var.set_delay_after_power_forze_button(config[CONF_DELAY_UPDATE_AFTER_FORZE_POWER_BUTTON])
         )
+    cg.add(var.set_coalesce_window(config[CONF_COALESCE_WINDOW]))
+    cg.add(var.set_save_delay(config[CONF_SAVE_DELAY]))
+    cg.add(var.set_current_temperature_delta(config[CONF_CURRENT_TEMPERATURE_DELTA]))
     
 
 
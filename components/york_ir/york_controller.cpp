@@ -0,0 +1,74 @@
+#include "york_controller.h"
+#include "york_ir.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstdlib>
+
+namespace esphome {
+namespace york_ir {
+
+static const char *const TAG = "york_ir.controller";
+
+void YorkController::dump_config() {
+  ESP_LOGCONFIG(TAG, "York Controller:");
+  ESP_LOGCONFIG(TAG, "  Units: %u", (unsigned) this->units_.size());
+  ESP_LOGCONFIG(TAG, "  Frame gap: %" PRIu32 "ms", this->frame_gap_);
+  ESP_LOGCONFIG(TAG, "  Ignore RX after TX: %" PRIu32 "ms", this->ignore_rx_after_tx_);
+}
+
+void YorkController::register_unit(YorkClimateIR *unit, bool receive) {
+  unit->set_controller(this);
+  this->units_.push_back({unit, receive});
+}
+
+void YorkController::queue_frame(YorkClimateIR *unit, const remote_base::YorkData &frame) {
+  for (auto &pending : this->queue_) {
+    if (pending.unit == unit && !YorkIRData(pending.frame).get_IR_power()) {
+      pending.frame = frame;
+      return;
+    }
+  }
+  this->queue_.push_back({unit, frame});
+  if (!this->sending_)
+    this->send_next_();
+}
+
+void YorkController::send_next_() {
+  if (this->queue_.empty()) {
+    this->sending_ = false;
+    return;
+  }
+  this->sending_ = true;
+  const PendingFrame pending = this->queue_.front();
+  this->queue_.pop_front();
+
+  // The shared blaster is seen by every receiver, its echo must not reach any unit
+  this->ignore_rx_ = true;
+  this->set_timeout("ignore_rx", this->ignore_rx_after_tx_, [this]() { this->ignore_rx_ = false; });
+
+  auto transmit = this->transmitter_->transmit();
+  remote_base::YorkProtocol().encode(transmit.get_data(), pending.frame);
+  uint32_t length = 0;
+  for (int32_t value : transmit.get_data()->get_data())
+    length += std::abs(value);
+  ESP_LOGV(TAG, "Sending frame of unit %p, %u still queued", pending.unit, (unsigned) this->queue_.size());
+  transmit.perform();
+
+  // The next frame starts once this one is out and the unit had time to take it
+  this->set_timeout("next", length / 1000 + this->frame_gap_, [this]() { this->send_next_(); });
+}
+
+bool YorkController::on_receive(remote_base::RemoteReceiveData data) {
+  auto frame = remote_base::YorkProtocol().decode(data);
+  if (this->ignore_rx_ || !frame.has_value())
+    return false;
+  for (auto &unit : this->units_) {
+    if (unit.receive)
+      unit.unit->apply_frame_(*frame);
+  }
+  return true;
+}
+
+}  // namespace york_ir
+}  // namespace esphome
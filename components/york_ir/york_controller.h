@@ -0,0 +1,55 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/remote_base/york_protocol.h"
+
+namespace esphome {
+namespace york_ir {
+
+class YorkClimateIR;
+
+/// Drives several York units over one transmitter. Frames of all units go out one at a time from a shared queue,
+/// and the frames its receiver picks up are handed to every unit that follows the remote.
+class YorkController : public Component,
+                       public remote_base::RemoteReceiverListener,
+                       public remote_base::RemoteTransmittable {
+ public:
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::PROCESSOR; }
+
+  /// Units with receive set take over the state of York frames from other remotes.
+  void register_unit(YorkClimateIR *unit, bool receive);
+  void set_frame_gap(uint32_t value) { this->frame_gap_ = value; }
+  void set_ignore_rx_after_tx(uint32_t value) { this->ignore_rx_after_tx_ = value; }
+
+  /// Queue a frame for a unit. A frame still waiting for the same unit is replaced, unless it toggles power.
+  void queue_frame(YorkClimateIR *unit, const remote_base::YorkData &frame);
+
+ protected:
+  bool on_receive(remote_base::RemoteReceiveData data) override;
+  void send_next_();
+
+  struct Unit {
+    YorkClimateIR *unit;
+    bool receive;
+  };
+  struct PendingFrame {
+    YorkClimateIR *unit;
+    remote_base::YorkData frame;
+  };
+
+  std::vector<Unit> units_;
+  std::deque<PendingFrame> queue_;
+  uint32_t frame_gap_{0};
+  uint32_t ignore_rx_after_tx_{0};
+  /// A frame is on air or its gap has not passed yet
+  bool sending_{false};
+  bool ignore_rx_{false};
+};
+
+}  // namespace york_ir
+}  // namespace esphome
@@ -130,108 +130,117 @@ class YorkIRData : public remote_base::YorkData {
   }
  
 
+  // Frame layout, see the byte description at the top of this file
+  using ModeField = remote_base::FrameField<1, 0, 4>;
+  using FanModeField = remote_base::FrameField<1, 4, 4>;
+  using MinuteField = remote_base::FrameField<2, 0, 8, remote_base::FIELD_ENCODING_BCD>;
+  using HourField = remote_base::FrameField<3, 0, 8, remote_base::FIELD_ENCODING_BCD>;
+  using OnTimerHourField = remote_base::FrameField<4, 0, 6, remote_base::FIELD_ENCODING_BCD>;
+  using OnTimerHalfHourField = remote_base::FrameField<4, 6, 1>;
+  using OnTimerActiveField = remote_base::FrameField<4, 7, 1>;
+  using OffTimerHourField = remote_base::FrameField<5, 0, 6, remote_base::FIELD_ENCODING_BCD>;
+  using OffTimerHalfHourField = remote_base::FrameField<5, 6, 1>;
+  using OffTimerActiveField = remote_base::FrameField<5, 7, 1>;
+  using TempField = remote_base::FrameField<6, 0, 8, remote_base::FIELD_ENCODING_BCD>;
+  using SwingField = remote_base::FrameField<7, 0, 1>;
+  using SleepField = remote_base::FrameField<7, 1, 1>;
+  using PowerField = remote_base::FrameField<7, 3, 1>;
+
   void set_IR_mode(Mode mode) { 
-    this->set_value_(1, mode, 0b1111, 0); 
+    this->set<ModeField>(mode); 
   }
   Mode get_IR_mode() const { 
-    return static_cast<Mode>(this->get_value_(1, 0b1111, 0)); 
+    return static_cast<Mode>(this->get<ModeField>()); 
   }
 
   void set_IR_fan_mode(FanMode mode) { 
-    this->set_value_(1, mode, 0b1111, 4); 
+    this->set<FanModeField>(mode); 
   }
   FanMode get_IR_fan_mode() const { 
-    return static_cast<FanMode>(this->get_value_(1, 0b1111, 4)); 
+    return static_cast<FanMode>(this->get<FanModeField>()); 
   }
 
   void set_IR_temp(uint8_t val) { 
 
     if((val <= YORK_TEMPC_MAX && val >= YORK_TEMPC_MIN)) {
-      this->set_value_(6, (uint8_t)(val % 10), 0b1111, 0);
-      this->set_value_(6, (uint8_t)(val / 10), 0b1111, 4);
+      this->set<TempField>(val);
     } else {
-      this->set_value_(6, (uint8_t)(24 % 10), 0b1111, 0);
-      this->set_value_(6, (uint8_t)(24 / 10), 0b1111, 4);
+      this->set<TempField>(24);
     }
   }
   float get_IR_temp() const { 
-    return ((this->get_value_(6, 0b1111, 4) * 10) + (this->get_value_(6, 0b1111, 0))); 
+    return this->get<TempField>(); 
   }
 
   void set_IR_power(bool value) { 
-    this->set_value_(7, value, 0b0001, 3); 
+    this->set<PowerField>(value); 
   }
   bool get_IR_power() const { 
-    return this->get_value_(7, 0b0001, 3); 
+    return this->get<PowerField>(); 
   }
 
   void set_IR_currentTime( uint8_t hour,  uint8_t minute) {
-    if ((hour <= 24 && hour >= 0) && (minute <= 59 && minute >= 0)) {
-      this->set_value_(2, (uint8_t)(minute % 10), 0b1111, 0);
-      this->set_value_(2, (uint8_t)(minute / 10), 0b1111, 4);
-
-      this->set_value_(3, (uint8_t)(hour % 10), 0b1111, 0);
-      this->set_value_(3, (uint8_t)(hour / 10), 0b1111, 4);
+    if (hour <= 24 && minute <= 59) {
+      this->set<MinuteField>(minute);
+      this->set<HourField>(hour);
     } else {
-      this->set_value_(2, 0, 0);
-      this->set_value_(3, 0, 0);
+      this->set<MinuteField>(0);
+      this->set<HourField>(0);
     }
   }
   time_struct_t get_IR_currentTime() {
     time_struct_t currentTime;
-    currentTime.minute = ((this->get_value_(2, 0b1111, 4) * 10) + (this->get_value_(2, 0b1111, 0)));
-    currentTime.hour = ((this->get_value_(3, 0b1111, 4) * 10) + (this->get_value_(3, 0b1111, 0))); 
+    currentTime.minute = this->get<MinuteField>();
+    currentTime.hour = this->get<HourField>(); 
     return currentTime;
   }
  
   void set_IR_OnTimer(uint8_t hour, bool halfhour, bool active) {
-    if (hour <= 24 && hour >= 0) {
-      this->set_value_(4, (uint8_t)(hour % 10), 0b1111, 0);
-      this->set_value_(4, (uint8_t)(hour / 10), 0b0011, 4);
-      this->set_value_(4, halfhour, 0b0001, 6);
-      this->set_value_(4, active, 0b0001, 7);
+    if (hour <= 24) {
+      this->set<OnTimerHourField>(hour);
+      this->set<OnTimerHalfHourField>(halfhour);
+      this->set<OnTimerActiveField>(active);
     } else {
-      this->set_value_(4, 0, 0);
+      this->data_[OnTimerHourField::BYTE] = 0;
     }
   }
   timer_struct_t get_IR_OnTimer() const {
     timer_struct_t onTimer;
-    onTimer.hour =          ((this->get_value_(4, 0b0011, 4) * 10) + (this->get_value_(4, 0b1111, 0)));
-    onTimer.halfHour = (bool)(this->get_value_(4, 0b0001, 6));
-    onTimer.active   = (bool)(this->get_value_(4, 0b0001, 7));
+    onTimer.hour =     this->get<OnTimerHourField>();
+    onTimer.halfHour = this->get<OnTimerHalfHourField>();
+    onTimer.active   = this->get<OnTimerActiveField>();
     return onTimer;
   }    
 
   void set_IR_OffTimer(uint8_t hour, bool halfhour, bool active) {
-    if (hour <= 24 && hour >= 0) {
-      this->set_value_(5, (uint8_t)(hour % 10), 0b1111, 0);
-      this->set_value_(5, (uint8_t)(hour / 10), 0b0011, 4);
-      this->set_value_(5, halfhour, 0b0001, 6);
-      this->set_value_(5, active, 0b0001, 7);
+    if (hour <= 24) {
+      this->set<OffTimerHourField>(hour);
+      this->set<OffTimerHalfHourField>(halfhour);
+      this->set<OffTimerActiveField>(active);
     } else {
-      this->set_value_(5, 0, 0);
+      this->data_[OffTimerHourField::BYTE] = 0;
     }
   }
   timer_struct_t get_IR_OffTimer() const {
     timer_struct_t offTimer;
-    offTimer.hour =          ((this->get_value_(5, 0b0011, 4) * 10) + (this->get_value_(5, 0b1111, 0)));
-    offTimer.halfHour = (bool)(this->get_value_(5, 0b0001, 6));
-    offTimer.active   = (bool)(this->get_value_(5, 0b0001, 7));
+    offTimer.hour =     this->get<OffTimerHourField>();
+    offTimer.halfHour = this->get<OffTimerHalfHourField>();
+    offTimer.active   = this->get<OffTimerActiveField>();
     return offTimer;
   }   
  
   void set_IR_Sleep(bool active) {
-    this->set_value_(7, active, 0b0001, 1);
+    this->set<SleepField>(active);
   }
   bool get_IR_Sleep() const {
-    return (bool)(this->get_value_(7, 0b0001, 1));
+    return this->get<SleepField>();
   }
 
   void set_IR_Swing(bool active){
-    this->set_value_(7, active, 0b0001, 0);
+    this->set<SwingField>(active);
   }
   bool get_IR_Swing() const {
-    return (bool)(this->get_value_(7, 0b0001, 0));
+    return this->get<SwingField>();
   } 
 
 };
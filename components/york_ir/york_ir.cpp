@@ -1,12 +1,18 @@
 #include "york_ir.h"
 #include "york_data.h"
+#include "york_controller.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace esphome {
 namespace york_ir {
 
 static const char *const TAG = "york_ir.climate";
+// Mixed into the preference key, change it when restore_state_t changes
+static const uint32_t RESTORE_STATE_VERSION = 0x59524B01;
 
 float YorkClimateIR::get_setup_priority() const { 
   return setup_priority::PROCESSOR; 
@@ -16,8 +22,8 @@ void YorkClimateIR::setup() {
   if (this->sensor_) {
     this->sensor_->add_on_state_callback([this](float state) {
       this->current_temperature = state;
-      // current temperature changed, publish state
-      this->publish_state();
+      // current temperature changed, publish state if it moved far enough
+      this->publish_state_if_changed_();
     });
     this->current_temperature = this->sensor_->state;
   } else
@@ -40,63 +46,81 @@ void YorkClimateIR::setup() {
   if (std::isnan(this->target_temperature)) {
     this->target_temperature = 24;
   }
-}
-void YorkClimateIR::update() {
-  
-
-  this->millis_now_ = millis();
-  
-  // ignore RX after TX 
-  if (this->ignore_RX_after_TX_.activate) {
-    if( (this->ignore_RX_after_TX_.millisOld + this->ignore_RX_after_TX_.config) < this->millis_now_) {
-      this->ignore_RX_after_TX_.activate = false;
-    }
-  }
-  else {
-    this->ignore_RX_after_TX_.millisOld = this->millis_now_;
+  // restore the York frame, timers and power state, the AC still holds them after a reboot
+  this->pref_ = global_preferences->make_preference<restore_state_t>(this->get_object_id_hash() ^ RESTORE_STATE_VERSION);
+  restore_state_t saved{};
+  if (this->pref_.load(&saved)) {
+    std::copy_n(saved.frame, sizeof(saved.frame), this->IRData.data());
+    std::copy_n(saved.frame, sizeof(saved.frame), this->last_frame_.data());
+    this->last_frame_valid_ = true;
+    this->virtual_power_status_AC_ = saved.virtual_power_status;
+    this->old_TimerOn_ = saved.old_timer_on;
+    this->old_TimerOff_ = saved.old_timer_off;
+    this->saved_ = saved;
+    ESP_LOGD(TAG, "Restored IRData York: %s", this->IRData.to_string().c_str());
   }
-
-  // recover old TimerON
-  if (this->delay_Update_after_Forze_Power_On_Button_.activate) {
-    if( (this->delay_Update_after_Forze_Power_On_Button_.millisOld + (this->delay_Update_after_Forze_Power_On_Button_.config * 1000)) < this->millis_now_) {
-
-      this->delay_Update_after_Forze_Power_On_Button_.activate = false;
-      this->virtual_power_status_AC_ = true;
-
-      this->IRData.set_IR_OnTimer(this->old_TimerOn_.hour, this->old_TimerOn_.halfHour, this->old_TimerOn_.active);
-      this->old_TimerOn_.hour = 0;
-      this->old_TimerOn_.halfHour = false;
-      this->old_TimerOn_.active = false;
-
-      this->transmit_state(false);
-    }
+  this->update_sub_binary_sensor_(SubBinarySensorType::POWER_ON_STATUS, this->virtual_power_status_AC_);
+}
+void YorkClimateIR::set_virtual_power_status_(bool value) {
+  this->virtual_power_status_AC_ = value;
+  this->update_sub_binary_sensor_(SubBinarySensorType::POWER_ON_STATUS, value);
+  this->schedule_save_();
+}
+void YorkClimateIR::schedule_save_() {
+  if (this->save_delay_ == 0) {
+    this->save_state_();
+    return;
   }
-  else {
-    this->delay_Update_after_Forze_Power_On_Button_.millisOld = this->millis_now_;
+  if (this->save_pending_)
+    return;
+  this->save_pending_ = true;
+  this->set_timeout("save", this->save_delay_, [this]() {
+    this->save_pending_ = false;
+    this->save_state_();
+  });
+}
+void YorkClimateIR::on_safe_shutdown() {
+  // OTA and safe reboots keep a change still waiting for its save
+  if (this->save_pending_) {
+    this->cancel_timeout("save");
+    this->save_pending_ = false;
+    this->save_state_();
   }
+}
+void YorkClimateIR::save_state_() {
+  restore_state_t state{};
+  std::copy_n(this->IRData.data(), sizeof(state.frame), state.frame);
+  state.virtual_power_status = this->virtual_power_status_AC_;
+  state.old_timer_on = this->old_TimerOn_;
+  state.old_timer_off = this->old_TimerOff_;
+  if (state == this->saved_)
+    return;
+  if (this->pref_.save(&state))
+    this->saved_ = state;
+}
+// recover old TimerON
+void YorkClimateIR::finish_force_power_on_() {
+  this->delay_Update_after_Forze_Power_On_Button_.activate = false;
+  this->set_virtual_power_status_(true);
 
-  // recover old TimerOFF
-  if (this->delay_Update_after_Forze_Power_Off_Button_.activate) {
-    if( (this->delay_Update_after_Forze_Power_Off_Button_.millisOld + (this->delay_Update_after_Forze_Power_Off_Button_.config * 1000)) < this->millis_now_) {
-
-      this->delay_Update_after_Forze_Power_Off_Button_.activate = false;
-      this->virtual_power_status_AC_ = false;
-
-      this->IRData.set_IR_OffTimer(this->old_TimerOff_.hour, this->old_TimerOff_.halfHour, this->old_TimerOff_.active);
-      this->old_TimerOff_.hour = 0;
-      this->old_TimerOff_.halfHour = false;
-      this->old_TimerOff_.active = false;
+  this->IRData.set_IR_OnTimer(this->old_TimerOn_.hour, this->old_TimerOn_.halfHour, this->old_TimerOn_.active);
+  this->old_TimerOn_.hour = 0;
+  this->old_TimerOn_.halfHour = false;
+  this->old_TimerOn_.active = false;
 
-      this->transmit_state(false);
-    }
-  }
-  else {
-    this->delay_Update_after_Forze_Power_Off_Button_.millisOld = this->millis_now_;
-  }
+  this->transmit_state(false);
+}
+// recover old TimerOFF
+void YorkClimateIR::finish_force_power_off_() {
+  this->delay_Update_after_Forze_Power_Off_Button_.activate = false;
+  this->set_virtual_power_status_(false);
 
-  this->update_sub_binary_sensor_(SubBinarySensorType::POWER_ON_STATUS, this->virtual_power_status_AC_);
+  this->IRData.set_IR_OffTimer(this->old_TimerOff_.hour, this->old_TimerOff_.halfHour, this->old_TimerOff_.active);
+  this->old_TimerOff_.hour = 0;
+  this->old_TimerOff_.halfHour = false;
+  this->old_TimerOff_.active = false;
 
-  this->loopCounter_++;
+  this->transmit_state(false);
 }
  void YorkClimateIR::dump_config() { 
     ESP_LOGCONFIG(TAG, "IRData York: %s", this->IRData.to_string().c_str()); 
@@ -142,8 +166,44 @@ climate::ClimateTraits YorkClimateIR::traits() {
 
 
 
+void YorkClimateIR::schedule_transmit_() {
+  if (this->coalesce_window_ == 0) {
+    this->transmit_state(false);
+    return;
+  }
+  // The window is not restarted by later changes, a dragged slider still sends while it moves
+  if (this->transmit_pending_)
+    return;
+  this->transmit_pending_ = true;
+  this->set_timeout("transmit", this->coalesce_window_, [this]() {
+    this->transmit_pending_ = false;
+    this->transmit_state(false);
+  });
+}
+
+void YorkClimateIR::publish_state_if_changed_() {
+  if (this->last_published_.has_value()) {
+    const published_state_t &last = *this->last_published_;
+    // NAN compares unequal to itself, a sensor going away or coming back is a change
+    const bool current_unchanged =
+        std::isnan(this->current_temperature) == std::isnan(last.current_temperature) &&
+        (std::isnan(this->current_temperature) ||
+         std::fabs(this->current_temperature - last.current_temperature) < this->current_temperature_delta_ ||
+         this->current_temperature == last.current_temperature);
+    if (current_unchanged && this->mode == last.mode && this->target_temperature == last.target_temperature &&
+        this->fan_mode == last.fan_mode && this->swing_mode == last.swing_mode && this->preset == last.preset)
+      return;
+  }
+  this->last_published_ = published_state_t{this->mode,      this->target_temperature, this->current_temperature,
+                                            this->fan_mode,  this->swing_mode,         this->preset};
+  this->publish_state();
+}
+
 void YorkClimateIR::transmit_state(bool power_button) {
-  auto transmit = this->transmitter_->transmit();
+  if (this->transmit_pending_) {
+    this->cancel_timeout("transmit");
+    this->transmit_pending_ = false;
+  }
 
   // Power Button
   this->IRData.set_IR_power(power_button);
@@ -193,75 +253,102 @@ void YorkClimateIR::transmit_state(bool power_button) {
 
   this->IRData.finalize();
 
-  this->ignore_RX_after_TX_.activate = true;
+  // The power toggle bit changes the AC state by itself, any other frame equal to the known state changes nothing
+  if (!power_button && this->last_frame_valid_ &&
+      std::equal(this->IRData.data(), this->IRData.data() + this->IRData.size(), this->last_frame_.data())) {
+    ESP_LOGV(TAG, "State unchanged, not transmitting");
+    return;
+  }
+  std::copy_n(this->IRData.data(), this->IRData.size(), this->last_frame_.data());
+  this->last_frame_valid_ = true;
 
-  remote_base::YorkProtocol().encode(transmit.get_data(), this->IRData);
-  transmit.perform();
+  if (this->controller_ != nullptr) {
+    // Sent from the shared queue, the controller ignores RX after it for all units
+    this->controller_->queue_frame(this, this->IRData);
+  } else {
+    // ignore RX after TX, re-arming replaces the timeout of an earlier frame
+    this->ignore_RX_after_TX_.activate = true;
+    this->set_timeout("ignore_rx", this->ignore_RX_after_TX_.config,
+                      [this]() { this->ignore_RX_after_TX_.activate = false; });
+
+    auto transmit = this->transmitter_->transmit();
+    remote_base::YorkProtocol().encode(transmit.get_data(), this->IRData);
+    transmit.perform();
+  }
 
   this->IRData.set_IR_power(false);
+  this->schedule_save_();
 }
 bool YorkClimateIR::on_receive(remote_base::RemoteReceiveData data) {
   auto YorkIR_RxData = remote_base::YorkProtocol().decode(data);
 
-  if ((!this->ignore_RX_after_TX_.activate) && YorkIR_RxData.has_value()) {
-    const remote_base::YorkData IRData = *YorkIR_RxData;
-    
-    const uint8_t* data = IRData.data();
-    std::vector<uint8_t> vec(data, data + IRData.size());
-    this->IRData.setData(vec); 
-    
-    // Temp
-    this->target_temperature = this->IRData.get_IR_temp();
+  if ((!this->ignore_RX_after_TX_.activate) && YorkIR_RxData.has_value())
+    this->apply_frame_(*YorkIR_RxData);
+
+  return true;
+}
+void YorkClimateIR::apply_frame_(const remote_base::YorkData &IRData) {
+  // Repeats and frames of other remotes that leave the AC as it is, power toggles always change it
+  if (this->last_frame_valid_ && !YorkIRData(IRData).get_IR_power() &&
+      std::equal(IRData.data(), IRData.data() + IRData.size(), this->last_frame_.data()))
+    return;
+  std::copy_n(IRData.data(), IRData.size(), this->last_frame_.data());
+  this->last_frame_valid_ = true;
+
+  const uint8_t* data = IRData.data();
+  std::vector<uint8_t> vec(data, data + IRData.size());
+  this->IRData.setData(vec); 
+  this->schedule_save_();
   
-    // Mode
-    switch (this->IRData.get_IR_mode()) {
-      case this->IRData.MODE_COOL:
-        this->mode = climate::CLIMATE_MODE_COOL;
-        break;
-      case this->IRData.MODE_DRY:
-        this->mode = climate::CLIMATE_MODE_DRY;
-        break;
-      case this->IRData.MODE_FAN_ONLY:
-        this->mode = climate::CLIMATE_MODE_FAN_ONLY;
-        break;
-      default:
-        this->mode = climate::CLIMATE_MODE_COOL;
-        break;
-    }
+  // Temp
+  this->target_temperature = this->IRData.get_IR_temp();
+
+  // Mode
+  switch (this->IRData.get_IR_mode()) {
+    case this->IRData.MODE_COOL:
+      this->mode = climate::CLIMATE_MODE_COOL;
+      break;
+    case this->IRData.MODE_DRY:
+      this->mode = climate::CLIMATE_MODE_DRY;
+      break;
+    case this->IRData.MODE_FAN_ONLY:
+      this->mode = climate::CLIMATE_MODE_FAN_ONLY;
+      break;
+    default:
+      this->mode = climate::CLIMATE_MODE_COOL;
+      break;
+  }
 
 
-    switch (this->IRData.get_IR_fan_mode()) {
-      case this->IRData.FAN_LOW:
-        this->fan_mode = climate::CLIMATE_FAN_LOW;
-        this->preset = climate::CLIMATE_PRESET_NONE;
-        break;
-      case this->IRData.FAN_MEDIUM:
-        this->fan_mode = climate::CLIMATE_FAN_MEDIUM;
-        this->preset = climate::CLIMATE_PRESET_NONE;
-        break;
-      case this->IRData.FAN_HIGH:
-        this->fan_mode = climate::CLIMATE_FAN_HIGH;
-        this->preset = climate::CLIMATE_PRESET_NONE;
-        break;
-      case this->IRData.FAN_AUTO:
-        this->fan_mode = climate::CLIMATE_FAN_AUTO;
-        this->preset = climate::CLIMATE_PRESET_NONE;
-        break;
-
-      case this->IRData.FAN_QUIET:
-        this->fan_mode = climate::CLIMATE_FAN_LOW;
-        this->preset = climate::CLIMATE_PRESET_SLEEP;
-        break;
-      case this->IRData.FAN_TURBO:
-        this->fan_mode = climate::CLIMATE_FAN_HIGH;
-        this->preset = climate::CLIMATE_PRESET_BOOST;
-        break;
-    }
+  switch (this->IRData.get_IR_fan_mode()) {
+    case this->IRData.FAN_LOW:
+      this->fan_mode = climate::CLIMATE_FAN_LOW;
+      this->preset = climate::CLIMATE_PRESET_NONE;
+      break;
+    case this->IRData.FAN_MEDIUM:
+      this->fan_mode = climate::CLIMATE_FAN_MEDIUM;
+      this->preset = climate::CLIMATE_PRESET_NONE;
+      break;
+    case this->IRData.FAN_HIGH:
+      this->fan_mode = climate::CLIMATE_FAN_HIGH;
+      this->preset = climate::CLIMATE_PRESET_NONE;
+      break;
+    case this->IRData.FAN_AUTO:
+      this->fan_mode = climate::CLIMATE_FAN_AUTO;
+      this->preset = climate::CLIMATE_PRESET_NONE;
+      break;
 
-    this->publish_state();
+    case this->IRData.FAN_QUIET:
+      this->fan_mode = climate::CLIMATE_FAN_LOW;
+      this->preset = climate::CLIMATE_PRESET_SLEEP;
+      break;
+    case this->IRData.FAN_TURBO:
+      this->fan_mode = climate::CLIMATE_FAN_HIGH;
+      this->preset = climate::CLIMATE_PRESET_BOOST;
+      break;
   }
 
-  return true;
+  this->publish_state_if_changed_();
 }
 
 
@@ -278,31 +365,39 @@ void YorkClimateIR::control(const climate::ClimateCall &call) {
     this->swing_mode = *call.get_swing_mode();
   if (call.get_preset().has_value())
     this->preset = *call.get_preset();
-  this->transmit_state(false);
-  this->publish_state();
+  this->schedule_transmit_();
+  this->publish_state_if_changed_();
 }
 
 
 
 void YorkClimateIR::button_force_power_on() {
-  this->old_TimerOn_ = this->IRData.get_IR_OnTimer();
+  // Pressed again before the delay ran out, the saved timer is still the user's
+  if (!this->delay_Update_after_Forze_Power_On_Button_.activate)
+    this->old_TimerOn_ = this->IRData.get_IR_OnTimer();
   this->IRData.set_IR_OnTimer(1,false,true);
   this->IRData.set_IR_currentTime(0,59);
 
   this->transmit_state(!this->virtual_power_status_AC_);
   this->delay_Update_after_Forze_Power_On_Button_.activate = true;
+  this->set_timeout("force_power_on", this->delay_Update_after_Forze_Power_On_Button_.config * 1000,
+                    [this]() { this->finish_force_power_on_(); });
 }
 void YorkClimateIR::button_force_power_off(){
-  this->old_TimerOff_ = this->IRData.get_IR_OffTimer();
+  // Pressed again before the delay ran out, the saved timer is still the user's
+  if (!this->delay_Update_after_Forze_Power_Off_Button_.activate)
+    this->old_TimerOff_ = this->IRData.get_IR_OffTimer();
   this->IRData.set_IR_OffTimer(2,false,true);
   this->IRData.set_IR_currentTime(1,59);
 
   this->transmit_state(this->virtual_power_status_AC_);
   this->delay_Update_after_Forze_Power_Off_Button_.activate = true;
+  this->set_timeout("force_power_off", this->delay_Update_after_Forze_Power_Off_Button_.config * 1000,
+                    [this]() { this->finish_force_power_off_(); });
 }
 void YorkClimateIR::button_togel_power_onoff(){
   this->transmit_state(true);
-  this->virtual_power_status_AC_ = !this->virtual_power_status_AC_;
+  this->set_virtual_power_status_(!this->virtual_power_status_AC_);
 }
 void YorkClimateIR::button_dump_ir_data(){
   YorkClimateIR::dump_config();
@@ -1,19 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/remote_base/remote_base.h"
-#include "esphome/components/remote_transmitter/remote_transmitter.h"
 #include "esphome/components/sensor/sensor.h"
+#include "esphome/core/preferences.h"
 
 #include "york_data.h"
 
 namespace esphome {
 namespace york_ir {
 
+class YorkController;
 
-class YorkClimateIR : public PollingComponent,
+
+class YorkClimateIR : public Component,
                       public climate::Climate,
                       public remote_base::RemoteReceiverListener,
                       public remote_base::RemoteTransmittable {            
@@ -25,12 +29,10 @@ class YorkClimateIR : public PollingComponent,
 
   YorkIRData IRData;
 
-  uint32_t millis_now_;
-
 
 
   void setup() override;
-  void update() override;
+  void on_safe_shutdown() override;
   float get_setup_priority() const override;
   void dump_config() override;
   void set_sensor(sensor::Sensor *sensor) { 
@@ -39,6 +41,14 @@ class YorkClimateIR : public PollingComponent,
   void set_ignore_rx_after_tx(uint32_t value) { 
     this->ignore_RX_after_TX_.config = value; 
   }
+  /// Climate calls within this many ms of the first one are sent as one frame, 0 sends every call right away.
+  void set_coalesce_window(uint32_t value) { this->coalesce_window_ = value; }
+  /// Send through the shared queue of a controller instead of this unit's own transmitter.
+  void set_controller(YorkController *controller) { this->controller_ = controller; }
+  /// Changes to the saved York state within this many ms of the first one cost one flash write.
+  void set_save_delay(uint32_t value) { this->save_delay_ = value; }
+  /// Current temperature changes smaller than this are not published on their own.
+  void set_current_temperature_delta(float value) { this->current_temperature_delta_ = value; }
   void set_delay_after_power_forze_button(uint32_t value) {
     this->delay_Update_after_Forze_Power_On_Button_.config = value;
     this->delay_Update_after_Forze_Power_Off_Button_.config = value;
@@ -51,9 +61,9 @@ class YorkClimateIR : public PollingComponent,
   void button_dump_ir_data();
 
 
+  /// A one-shot scheduler timeout, active from arming until it expires or is re-armed.
   struct timeout_t {
     uint32_t config;
-    uint32_t millisOld;
     bool activate;
   };
 
@@ -70,11 +80,52 @@ class YorkClimateIR : public PollingComponent,
   /// Return the traits of this controller.
   climate::ClimateTraits traits() override;
 
-  /// Transmit via IR the state of this climate controller.
+  /// Transmit via IR the state of this climate controller, includes and cancels a coalesced transmit.
   virtual void transmit_state(bool power_button);
+  /// Transmit the state once the coalescing window of the first pending change expires.
+  void schedule_transmit_();
+  /// Publish the climate state unless it matches the last published one.
+  void publish_state_if_changed_();
+
+  /// Save the York state once the save delay of the first pending change expires.
+  void schedule_save_();
+  void save_state_();
+
+  /// York state the generic climate restore does not cover
+  struct restore_state_t {
+    uint8_t frame[8];
+    bool virtual_power_status;
+    YorkIRData::timer_struct_t old_timer_on;
+    YorkIRData::timer_struct_t old_timer_off;
+
+    /// Field by field, the padding is not guaranteed to survive a copy.
+    bool operator==(const restore_state_t &other) const {
+      return std::equal(std::begin(this->frame), std::end(this->frame), std::begin(other.frame)) &&
+             this->virtual_power_status == other.virtual_power_status &&
+             same_timer(this->old_timer_on, other.old_timer_on) &&
+             same_timer(this->old_timer_off, other.old_timer_off);
+    }
+    static bool same_timer(const YorkIRData::timer_struct_t &a, const YorkIRData::timer_struct_t &b) {
+      return a.hour == b.hour && a.halfHour == b.halfHour && a.active == b.active;
+    }
+  };
+
+  /// Climate fields as last sent to the API
+  struct published_state_t {
+    climate::ClimateMode mode;
+    float target_temperature;
+    float current_temperature;
+    optional<climate::ClimateFanMode> fan_mode;
+    climate::ClimateSwingMode swing_mode;
+    optional<climate::ClimatePreset> preset;
+  };
+
+  friend class YorkController;
 
   // Dummy implement on_receive so implementation is optional for inheritors
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  /// Take over the state of a frame received from another remote.
+  void apply_frame_(const remote_base::YorkData &IRData);
 
   sensor::Sensor *sensor_{nullptr};
 
@@ -82,12 +133,31 @@ class YorkClimateIR : public PollingComponent,
   binary_sensor::BinarySensor *sub_binary_sensors_[(size_t) SubBinarySensorType::SUB_BINARY_SENSOR_TYPE_COUNT]{nullptr};
   int big_data_sensors_{0};
 
-  uint32_t loopCounter_ = 0;
-
-  bool virtual_power_status_AC_;
-  timeout_t ignore_RX_after_TX_;
-  timeout_t delay_Update_after_Forze_Power_On_Button_;
-  timeout_t delay_Update_after_Forze_Power_Off_Button_;
+  /// Power status changes are published as they happen, nothing runs while the unit is idle.
+  void set_virtual_power_status_(bool value);
+  void finish_force_power_on_();
+  void finish_force_power_off_();
+
+  YorkController *controller_{nullptr};
+  uint32_t coalesce_window_{0};
+  bool transmit_pending_{false};
+
+  /// Frame the AC is known to be in, last sent or received
+  remote_base::YorkData last_frame_;
+  bool last_frame_valid_{false};
+  optional<published_state_t> last_published_;
+
+  ESPPreferenceObject pref_;
+  /// State as last written to flash
+  restore_state_t saved_{};
+  uint32_t save_delay_{0};
+  bool save_pending_{false};
+  float current_temperature_delta_{0.0f};
+
+  bool virtual_power_status_AC_{false};
+  timeout_t ignore_RX_after_TX_{};
+  timeout_t delay_Update_after_Forze_Power_On_Button_{};
+  timeout_t delay_Update_after_Forze_Power_Off_Button_{};
 
   YorkIRData::timer_struct_t old_TimerOn_;
   YorkIRData::timer_struct_t old_TimerOff_;